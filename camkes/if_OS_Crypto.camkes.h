@@ -33,6 +33,12 @@
         in OS_CryptoMac_Handle_t macHandle,             \
         inout size_t macSize                            \
     );                                                  \
+    OS_Error_t Mac_oneShot(                             \
+        in OS_CryptoKey_Handle_t keyHandle,             \
+        in unsigned int algorithm,                      \
+        in size_t dataSize,                             \
+        inout size_t macSize                            \
+    );                                                  \
     \
     OS_Error_t Digest_init(                             \
         inout OS_CryptoDigest_Handle_t pDigestHandle,   \
@@ -53,6 +59,11 @@
         in OS_CryptoDigest_Handle_t digestHandle,       \
         inout size_t digestSize                         \
     );                                                  \
+    OS_Error_t Digest_oneShot(                          \
+        in unsigned int algorithm,                      \
+        in size_t inLen,                                \
+        inout size_t digestSize                         \
+    );                                                  \
     \
     OS_Error_t Key_generate(                            \
         inout OS_CryptoKey_Handle_t pKeyHandle          \
@@ -67,6 +78,14 @@
     OS_Error_t Key_export(                              \
         in OS_CryptoKey_Handle_t keyHandle              \
     );                                                  \
+    OS_Error_t Key_importCompact(                       \
+        inout OS_CryptoKey_Handle_t pKeyHandle,         \
+        in size_t len                                   \
+    );                                                  \
+    OS_Error_t Key_exportCompact(                       \
+        in OS_CryptoKey_Handle_t keyHandle,             \
+        inout size_t len                                \
+    );                                                  \
     OS_Error_t Key_getParams(                           \
         in OS_CryptoKey_Handle_t keyHandle,             \
         inout size_t paramSize                          \
@@ -102,6 +121,11 @@
     OS_Error_t Signature_free(                          \
         in OS_CryptoSignature_Handle_t sigHandle        \
     );                                                  \
+    OS_Error_t Signature_verifyBatch(                   \
+        in unsigned int algorithm,                      \
+        in unsigned int digest,                         \
+        in size_t numItems                              \
+    );                                                  \
     \
     OS_Error_t Agreement_init(                          \
         inout OS_CryptoAgreement_Handle_t pAgrHandle,   \
@@ -123,6 +147,10 @@
         in unsigned int algorithm,                      \
         in size_t ivLen                                 \
     );                                                  \
+    OS_Error_t Cipher_reinit(                           \
+        in OS_CryptoCipher_Handle_t cipherHandle,       \
+        in size_t ivLen                                 \
+    );                                                  \
     OS_Error_t Cipher_free(                             \
         in OS_CryptoCipher_Handle_t cipherHandle        \
     );                                                  \
@@ -138,4 +166,12 @@
     OS_Error_t Cipher_finalize(                         \
         in OS_CryptoCipher_Handle_t cipherHandle,       \
         inout size_t len                                \
-    );
\ No newline at end of file
+    );                                                  \
+    \
+    OS_Error_t Crypto_batch(                            \
+        in size_t numOps                                \
+    );                                                  \
+    OS_Error_t Crypto_getCapabilities(                  \
+        inout uint32_t caps                             \
+    );                                                  \
+    OS_Error_t Crypto_getKeyCacheStats(void);
\ No newline at end of file
@@ -251,7 +251,8 @@ OS_CertParser_verifyChain(
  *
  * Create a cert handle by parsing a blob of cert data in different encodings
  * into its internal structure. This function will make sure the certificate
- * algorithms are supported.
+ * algorithms are supported; certificates can be signed with RSA or with ECDSA
+ * on the SECP192r1, SECP224r1 or SECP256r1 curve.
  *
  * @param hCert pointer to cert handle to be initialized
  * @param hParser handle of OS CertParser API
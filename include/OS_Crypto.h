@@ -21,6 +21,7 @@
 #include "interfaces/if_OS_Entropy.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 /**
  * The Crypto API can be instantiated in different modes, which basically determine
@@ -55,6 +56,86 @@ typedef enum
     OS_Crypto_MODE_KEY_SWITCH,
 } OS_Crypto_Mode_t;
 
+/**
+ * Hardware features the implementation of the Crypto API can make use of. The
+ * features are detected during OS_Crypto_init(); wherever a feature is not
+ * available, a portable software implementation is used.
+ */
+typedef enum
+{
+    OS_Crypto_CAP_NONE              = 0,
+
+    /**
+     * AES rounds are computed with the x86 AES-NI instructions.
+     */
+    OS_Crypto_CAP_X86_AESNI         = (1u << 0),
+
+    /**
+     * GHASH of AES-GCM is computed with the x86 PCLMULQDQ instruction.
+     */
+    OS_Crypto_CAP_X86_PCLMULQDQ     = (1u << 1),
+
+    /**
+     * AES rounds are computed with the ARMv8 crypto extensions.
+     */
+    OS_Crypto_CAP_ARMV8_AES         = (1u << 2),
+
+    /**
+     * GHASH of AES-GCM is computed with the ARMv8 PMULL instruction.
+     */
+    OS_Crypto_CAP_ARMV8_PMULL       = (1u << 3),
+} OS_Crypto_Cap_t;
+
+/**
+ * Capabilities in effect for an instance of the Crypto API; each field is a
+ * combination of OS_Crypto_Cap_t flags.
+ */
+typedef struct
+{
+    /**
+     * Features used by the local library instance (zero in
+     * OS_Crypto_MODE_CLIENT)
+     */
+    uint32_t local;
+
+    /**
+     * Features used by the remote instance (zero in OS_Crypto_MODE_LIBRARY)
+     */
+    uint32_t remote;
+} OS_Crypto_Capabilities_t;
+
+/**
+ * Counters of a key cache (see OS_Crypto_KeyCache_t); this is also what the
+ * remote instance writes to the dataport for the Crypto_getKeyCacheStats RPC.
+ */
+typedef struct
+{
+    uint64_t lookups;   ///< imports checked against the cache
+    uint64_t hits;      ///< imports served by a cached key
+    uint64_t evictions; ///< unreferenced keys dropped to make room
+    uint32_t entries;   ///< keys currently held by the cache
+    uint32_t capacity;  ///< maximum number of keys in the cache
+} OS_Crypto_KeyCacheCounters_t;
+
+/**
+ * Statistics of the key cache of the local library instance and the remote
+ * instance of the Crypto API; counters of an instance without a key cache are
+ * zero.
+ */
+typedef struct
+{
+    /**
+     * Counters of the local library instance (zero in OS_Crypto_MODE_CLIENT)
+     */
+    OS_Crypto_KeyCacheCounters_t local;
+
+    /**
+     * Counters of the remote instance, only covering the entries of the
+     * calling client (zero in OS_Crypto_MODE_LIBRARY)
+     */
+    OS_Crypto_KeyCacheCounters_t remote;
+} OS_Crypto_KeyCacheStats_t;
+
 /// @cond INTERNAL
 //------------------------------------------------------------------------------
 typedef struct OS_Crypto OS_Crypto_t;
@@ -74,6 +155,7 @@ typedef struct OS_Crypto_Object OS_Crypto_Object_t;
 #include "crypto/OS_CryptoMac.h"
 #include "crypto/OS_CryptoSignature.h"
 #include "crypto/OS_CryptoRng.h"
+#include "crypto/OS_CryptoPool.h"
 
 // Include this after the respective OS_CryptoXXX_Handle_t are defined, which
 // requires:
@@ -82,23 +164,148 @@ typedef struct OS_Crypto_Object OS_Crypto_Object_t;
 #include "interfaces/if_OS_Crypto.h"
 
 /**
- * User of API can provide custom allocator functionality.
+ * Operations which can be executed with OS_Crypto_batch().
+ */
+typedef enum
+{
+    OS_Crypto_BATCH_OP_NONE = 0,
+
+    /**
+     * Same as OS_CryptoDigest_process(), the output is not used.
+     */
+    OS_Crypto_BATCH_OP_DIGEST_PROCESS,
+
+    /**
+     * Same as OS_CryptoMac_process(), the output is not used.
+     */
+    OS_Crypto_BATCH_OP_MAC_PROCESS,
+
+    /**
+     * Same as OS_CryptoCipher_process().
+     */
+    OS_Crypto_BATCH_OP_CIPHER_PROCESS,
+} OS_Crypto_BatchOp_t;
+
+/**
+ * A single operation of a batch.
+ */
+typedef struct
+{
+    /**
+     * Handle of OS Crypto DIGEST, MAC or CIPHER object matching the operation
+     */
+    OS_Crypto_Object_t* handle;
+
+    /**
+     * Operation to perform
+     */
+    OS_Crypto_BatchOp_t op;
+
+    /**
+     * Input data and its length
+     */
+    const void* input;
+    size_t inputSize;
+
+    /**
+     * Buffer for output data and its size, will be set to the amount of bytes
+     * written (only for OS_Crypto_BATCH_OP_CIPHER_PROCESS)
+     */
+    void* output;
+    size_t outputSize;
+
+    /**
+     * Result of the operation, set by OS_Crypto_batch()
+     */
+    OS_Error_t result;
+} OS_Crypto_BatchItem_t;
+
+/**
+ * User of API can provide custom allocator functionality; use
+ * OS_CRYPTO_MEMORY_POOL to assign the pool allocator of OS_CryptoPool.
  */
 typedef struct
 {
     void* (*calloc)(size_t n, size_t size);
     void  (*free)(void* ptr);
+
+    /**
+     * Optional, called by OS_Crypto_free() after the API instance has released
+     * its own memory, so the allocator can report objects that were not freed
+     */
+    void  (*checkLeaks)(void);
 } OS_Crypto_Memory_t;
 
+/**
+ * User of API can provide worker threads to split large CIPHER operations on
+ * independent blocks (AES-ECB, AES-CTR and the encryption part of AES-GCM)
+ * across them. The Crypto API does not create threads itself, it hands jobs to
+ * the user's workers via dispatch() and waits for them via join().
+ *
+ * Each CIPHER operation that is split passes its own \p ctx to dispatch() and
+ * join(), so workers shared by several threads or Crypto API instances only
+ * make an operation wait for its own jobs. Every job records its result in the
+ * \p arg it was given, which the Crypto API checks after join() returned; an
+ * operation fails if any of its jobs failed.
+ */
+typedef struct
+{
+    /**
+     * Number of workers available, 0 disables parallel processing
+     */
+    size_t num;
+
+    /**
+     * Only inputs of at least this many bytes are split across the workers
+     */
+    size_t threshold;
+
+    /**
+     * Run job(arg) on worker \p idx (0 <= idx < num) as part of the operation
+     * identified by \p ctx; must not block
+     */
+    OS_Error_t (*dispatch)(void* ctx, size_t idx, void (*job)(void* arg),
+                           void* arg);
+
+    /**
+     * Wait until all jobs passed to dispatch() with the same \p ctx have
+     * completed
+     */
+    void (*join)(void* ctx);
+} OS_Crypto_Workers_t;
+
+/**
+ * A library instance of the Crypto API (e.g., the one of a crypto server that
+ * serves remote instances) can keep imported keys in a bounded cache, keyed by
+ * a hash over the key data. Importing the same key data again then returns a
+ * handle to the cached key instead of setting up a new one; the cached key is
+ * only freed once all its handles are freed and it is evicted as the least
+ * recently used unreferenced entry.
+ *
+ * If the instance serves remote instances, each entry belongs to the client
+ * that imported it; the hash includes the client's identity, so a client can
+ * never obtain (or detect) a key cached for another client. The capacity is
+ * shared by all clients.
+ */
+typedef struct
+{
+    /**
+     * Maximum number of keys in the cache, 0 disables the cache
+     */
+    size_t entries;
+} OS_Crypto_KeyCache_t;
+
 /**
  * The Crypto API main configuration struct; first the mode needs to be set to
  * the desired value, then the respective sub-configuration must be filled in:
  *
- * |                           | cfg.memory | cfg.entropy | cfg.rpc |
- * |---------------------------|------------|-------------|---------|
- * | OS_Crypto_MODE_LIBRARY    |     X      |      X      |         |
- * | OS_Crypto_MODE_CLIENT     |     X      |             |    X    |
- * | OS_Crypto_MODE_KEY_SWITCH |     X      |      X      |    X    |
+ * |                           | cfg.memory | cfg.entropy | cfg.rpc | cfg.workers | cfg.rng | cfg.keyCache |
+ * |---------------------------|------------|-------------|---------|-------------|---------|--------------|
+ * | OS_Crypto_MODE_LIBRARY    |     X      |      X      |         |    (X)      |   (X)   |     (X)      |
+ * | OS_Crypto_MODE_CLIENT     |     X      |             |    X    |             |   (X)   |              |
+ * | OS_Crypto_MODE_KEY_SWITCH |     X      |      X      |    X    |    (X)      |   (X)   |     (X)      |
+ *
+ * Fields marked with (X) are optional.
  */
 typedef struct
 {
@@ -125,6 +332,24 @@ typedef struct
      * functionality.
      */
     if_OS_Crypto_t rpc;
+
+    /**
+     * Optional workers for large CIPHER operations in the local library
+     * instance; leave zeroed to process everything in the calling thread.
+     */
+    OS_Crypto_Workers_t workers;
+
+    /**
+     * Optional buffered front end for the RNG; leave zeroed to serve every
+     * request from the RNG directly.
+     */
+    OS_CryptoRng_Pool_t rng;
+
+    /**
+     * Optional cache for keys imported into the local library instance; leave
+     * zeroed to set up a new key with every import.
+     */
+    OS_Crypto_KeyCache_t keyCache;
 } OS_Crypto_Config_t;
 
 /**
@@ -161,6 +386,76 @@ OS_Error_t
 OS_Crypto_free(
     OS_Crypto_Handle_t hCrypto);
 
+/**
+ * @brief Get hardware features used by the Crypto API
+ *
+ * Reports which accelerated code paths the local and/or remote instance of the
+ * Crypto API have selected during initialization. The algorithms offered by
+ * the API are the same regardless of the code path used.
+ *
+ * @param hCrypto (required) handle of OS Crypto API
+ * @param caps (required) buffer for capabilities
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid
+ */
+OS_Error_t
+OS_Crypto_getCapabilities(
+    OS_Crypto_Handle_t        hCrypto,
+    OS_Crypto_Capabilities_t* caps);
+
+/**
+ * @brief Get statistics of the key cache
+ *
+ * Reports the key cache statistics of the local library instance and/or the
+ * remote instance of the Crypto API. The counters of the remote instance only
+ * cover the imports and entries of the calling client; counters covering all
+ * clients are only available to the server, via its own library instance.
+ *
+ * @param hCrypto (required) handle of OS Crypto API
+ * @param stats (required) buffer for statistics
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid
+ */
+OS_Error_t
+OS_Crypto_getKeyCacheStats(
+    OS_Crypto_Handle_t         hCrypto,
+    OS_Crypto_KeyCacheStats_t* stats);
+
+/**
+ * @brief Execute a list of process operations at once
+ *
+ * Executes the operations given in \p items in order, as if the respective
+ * OS_CryptoXXX_process() function was called for each of them. In
+ * OS_Crypto_MODE_CLIENT (and for remote objects in OS_Crypto_MODE_KEY_SWITCH)
+ * as many operations as fit into the dataport are packed into a single RPC,
+ * instead of using one RPC per operation.
+ *
+ * The result of each operation is stored in its \p result field; a failing
+ * operation does not stop the execution of the following ones. An item whose
+ * input and output do not fit into the dataport is not executed and gets
+ * OS_ERROR_BUFFER_TOO_SMALL as its result.
+ *
+ * @param hCrypto (required) handle of OS Crypto API
+ * @param items (required) operations to execute
+ * @param numItems (required) number of operations in \p items
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if all operations succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid; in
+ *  this case no operation is executed and the \p result fields are not set
+ * @retval OS_ERROR_ABORTED if at least one of the operations failed or was not
+ *  executed
+ */
+OS_Error_t
+OS_Crypto_batch(
+    OS_Crypto_Handle_t     hCrypto,
+    OS_Crypto_BatchItem_t* items,
+    const size_t           numItems);
+
 /// @cond INTERNAL
 //------------------------------------------------------------------------------
 
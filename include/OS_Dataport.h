@@ -98,3 +98,234 @@ OS_Dataport_isUnset(
 
 // Fake dataport to be used on the host
 typedef uint8_t FakeDataport_t[PAGE_SIZE_4K];
+
+//------------------------------------------------------------------------------
+// Ring dataport
+//------------------------------------------------------------------------------
+
+/*
+ * A ring dataport splits a dataport into a control block followed by a fixed
+ * number of equally sized slots. The producer fills the slot at "head" and
+ * advances it, the consumer processes the slot at "tail" and advances it; this
+ * allows a client to queue several requests in the shared memory before the
+ * first one has been processed by the server.
+ *
+ * Both indices are free-running counters, the slot is derived from them modulo
+ * the number of slots. Each index is only ever written by one side, so no lock
+ * is needed as long as there is exactly one producer and one consumer.
+ *
+ * On the host, a ring can be laid over a FakeDataport_t (or any bigger buffer)
+ * via OS_DATAPORT_ASSIGN_RING() and used with the same functions.
+ */
+
+// Alignment of the control block and of every slot in the ring
+#define OS_DATAPORT_RING_ALIGN      64
+
+// Control block at the start of the ring dataport
+typedef struct
+{
+    uint32_t head;      ///< producer index, only written by producer
+    uint32_t tail;      ///< consumer index, only written by consumer
+    uint32_t slots;     ///< number of slots
+    uint32_t slotSize;  ///< size of a slot in bytes, including its header
+} __attribute__((aligned(OS_DATAPORT_RING_ALIGN))) OS_DataportRing_Ctrl_t;
+
+// Header in front of the payload of each slot
+typedef struct
+{
+    uint32_t id;        ///< request ID chosen by the producer
+    uint32_t len;       ///< length of the payload in bytes
+    int32_t  status;    ///< status of the request (e.g., an OS_Error_t)
+    uint32_t flags;     ///< user defined flags
+} OS_DataportRing_SlotHeader_t;
+
+typedef struct
+{
+    OS_Dataport_t dataport;
+    uint32_t      slots;
+} OS_DataportRing_t;
+
+// Access the ring dataport
+static __attribute__((unused)) OS_DataportRing_Ctrl_t*
+OS_DataportRing_getCtrl(
+    const OS_DataportRing_t ring)
+{
+    return (OS_DataportRing_Ctrl_t*) OS_Dataport_getBuf(ring.dataport);
+}
+static __attribute__((unused)) size_t
+OS_DataportRing_getSlotSize(
+    const OS_DataportRing_t ring)
+{
+    size_t size = OS_Dataport_getSize(ring.dataport);
+
+    if ((ring.slots == 0) || (size < sizeof(OS_DataportRing_Ctrl_t)))
+    {
+        return 0;
+    }
+    size = (size - sizeof(OS_DataportRing_Ctrl_t)) / ring.slots;
+    size -= size % OS_DATAPORT_RING_ALIGN;
+
+    return (size > sizeof(OS_DataportRing_SlotHeader_t)) ? size : 0;
+}
+// Maximum payload that fits into a single slot
+static __attribute__((unused)) size_t
+OS_DataportRing_getPayloadSize(
+    const OS_DataportRing_t ring)
+{
+    const size_t size = OS_DataportRing_getSlotSize(ring);
+    return (size > 0) ? size - sizeof(OS_DataportRing_SlotHeader_t) : 0;
+}
+static __attribute__((unused)) bool
+OS_DataportRing_isUnset(
+    const OS_DataportRing_t ring)
+{
+    return OS_Dataport_isUnset(ring.dataport) ||
+           (OS_DataportRing_getSlotSize(ring) == 0);
+}
+// Initialize the control block; must be done by exactly one side (typically
+// the server) before the ring is used.
+static __attribute__((unused)) bool
+OS_DataportRing_init(
+    const OS_DataportRing_t ring)
+{
+    OS_DataportRing_Ctrl_t* ctrl;
+
+    if (OS_DataportRing_isUnset(ring))
+    {
+        return false;
+    }
+
+    ctrl           = OS_DataportRing_getCtrl(ring);
+    ctrl->slots    = ring.slots;
+    ctrl->slotSize = (uint32_t) OS_DataportRing_getSlotSize(ring);
+    __atomic_store_n(&ctrl->tail, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&ctrl->head, 0, __ATOMIC_RELEASE);
+
+    return true;
+}
+// Check that the control block was set up for the same layout this side uses;
+// if both sides assign a different number of slots or a different size to the
+// ring, they would index different slots.
+static __attribute__((unused)) bool
+OS_DataportRing_isValid(
+    const OS_DataportRing_t ring)
+{
+    OS_DataportRing_Ctrl_t* ctrl;
+
+    if (OS_DataportRing_isUnset(ring))
+    {
+        return false;
+    }
+
+    ctrl = OS_DataportRing_getCtrl(ring);
+    return (__atomic_load_n(&ctrl->slots, __ATOMIC_ACQUIRE) == ring.slots) &&
+           (__atomic_load_n(&ctrl->slotSize, __ATOMIC_ACQUIRE) ==
+            OS_DataportRing_getSlotSize(ring));
+}
+// Get the amount of slots that are filled but not yet consumed
+static __attribute__((unused)) uint32_t
+OS_DataportRing_getPending(
+    const OS_DataportRing_t ring)
+{
+    OS_DataportRing_Ctrl_t* ctrl = OS_DataportRing_getCtrl(ring);
+    return __atomic_load_n(&ctrl->head, __ATOMIC_ACQUIRE) -
+           __atomic_load_n(&ctrl->tail, __ATOMIC_ACQUIRE);
+}
+static __attribute__((unused)) bool
+OS_DataportRing_isEmpty(
+    const OS_DataportRing_t ring)
+{
+    return (OS_DataportRing_getPending(ring) == 0);
+}
+static __attribute__((unused)) bool
+OS_DataportRing_isFull(
+    const OS_DataportRing_t ring)
+{
+    return (OS_DataportRing_getPending(ring) >= ring.slots);
+}
+// Get the slot with the given index (not the slot number)
+static __attribute__((unused)) OS_DataportRing_SlotHeader_t*
+OS_DataportRing_getSlot(
+    const OS_DataportRing_t ring,
+    const uint32_t          idx)
+{
+    uint8_t* base = (uint8_t*) OS_DataportRing_getCtrl(ring);
+    return (OS_DataportRing_SlotHeader_t*)(base +
+                                           sizeof(OS_DataportRing_Ctrl_t) +
+                                           (idx % ring.slots) *
+                                           OS_DataportRing_getSlotSize(ring));
+}
+// Get the payload following the header of a slot
+static __attribute__((unused)) void*
+OS_DataportRing_getPayload(
+    OS_DataportRing_SlotHeader_t* slot)
+{
+    return (void*)(slot + 1);
+}
+// Producer side: get the next free slot or NULL if the ring is full or does not
+// match the layout in the control block
+static __attribute__((unused)) OS_DataportRing_SlotHeader_t*
+OS_DataportRing_reserve(
+    const OS_DataportRing_t ring)
+{
+    OS_DataportRing_Ctrl_t* ctrl = OS_DataportRing_getCtrl(ring);
+
+    if (!OS_DataportRing_isValid(ring) || OS_DataportRing_isFull(ring))
+    {
+        return NULL;
+    }
+    return OS_DataportRing_getSlot(
+               ring, __atomic_load_n(&ctrl->head, __ATOMIC_RELAXED));
+}
+// Producer side: hand the slot obtained via reserve() over to the consumer
+static __attribute__((unused)) void
+OS_DataportRing_commit(
+    const OS_DataportRing_t ring)
+{
+    OS_DataportRing_Ctrl_t* ctrl = OS_DataportRing_getCtrl(ring);
+    __atomic_fetch_add(&ctrl->head, 1, __ATOMIC_RELEASE);
+}
+// Consumer side: get the oldest pending slot or NULL if the ring is empty or
+// does not match the layout in the control block
+static __attribute__((unused)) OS_DataportRing_SlotHeader_t*
+OS_DataportRing_peek(
+    const OS_DataportRing_t ring)
+{
+    OS_DataportRing_Ctrl_t* ctrl = OS_DataportRing_getCtrl(ring);
+
+    if (!OS_DataportRing_isValid(ring) || OS_DataportRing_isEmpty(ring))
+    {
+        return NULL;
+    }
+    return OS_DataportRing_getSlot(
+               ring, __atomic_load_n(&ctrl->tail, __ATOMIC_RELAXED));
+}
+// Consumer side: return the slot obtained via peek() to the producer
+static __attribute__((unused)) void
+OS_DataportRing_release(
+    const OS_DataportRing_t ring)
+{
+    OS_DataportRing_Ctrl_t* ctrl = OS_DataportRing_getCtrl(ring);
+    __atomic_fetch_add(&ctrl->tail, 1, __ATOMIC_RELEASE);
+}
+
+// Assign the ring dataport
+#define OS_DATAPORT_ASSIGN_RING(p, _slots_) {            \
+    .dataport = OS_DATAPORT_ASSIGN(p),                   \
+    .slots    = (_slots_)                                \
+}
+// Same as OS_DATAPORT_ASSIGN_SIZE(), but for a ring dataport.
+#define OS_DATAPORT_ASSIGN_RING_SIZE(p, _size_, _slots_) { \
+    .dataport = OS_DATAPORT_ASSIGN_SIZE(p, _size_),        \
+    .slots    = (_slots_)                                  \
+}
+// Same as OS_DATAPORT_ASSIGN_FUNC(), but for a ring dataport.
+#define OS_DATAPORT_ASSIGN_RING_FUNC(_p_func_, _size_func_, _slots_) { \
+    .dataport = OS_DATAPORT_ASSIGN_FUNC(_p_func_, _size_func_),        \
+    .slots    = (_slots_)                                              \
+}
+
+#define OS_DATAPORT_RING_NONE {         \
+    .dataport = OS_DATAPORT_NONE,       \
+    .slots    = 0                       \
+}
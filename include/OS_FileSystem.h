@@ -193,6 +193,76 @@ typedef union
     } spifFs;
 } OS_FileSystem_Format_t;
 
+/**
+ * Eviction policy of the block cache
+ */
+typedef enum
+{
+    OS_FileSystem_CachePolicy_NONE = 0,
+
+    /**
+     * Evict the least recently used block
+     */
+    OS_FileSystem_CachePolicy_LRU,
+
+    /**
+     * Evict blocks based on the CLOCK (second chance) algorithm; cheaper to
+     * maintain than LRU on every hit
+     */
+    OS_FileSystem_CachePolicy_CLOCK,
+} OS_FileSystem_CachePolicy_t;
+
+/**
+ * Configuration of the optional block cache between the file system and the
+ * underlying storage. The cache works on blocks of the size reported by the
+ * storage's getBlockSize(); the number of cached blocks is determined by the
+ * size of the arena. Erasing a range of the storage drops all cached blocks
+ * within it, including modified ones, as their content is superseded.
+ */
+typedef struct
+{
+    /**
+     * Eviction policy to use.
+     */
+    OS_FileSystem_CachePolicy_t policy;
+
+    /**
+     * Memory used for the cached blocks and their management data; can be
+     * NULL, then an arena of \p arenaSize bytes is allocated once during
+     * OS_FileSystem_init().
+     */
+    void* arena;
+
+    /**
+     * Size of the arena in bytes.
+     */
+    size_t arenaSize;
+
+    /**
+     * If set, writes only go to the cache and modified blocks are written to
+     * the storage when they are evicted, on OS_FileSystem_flush() or when
+     * unmounting. Otherwise writes go through to the storage immediately.
+     *
+     * NOTE: Write-back defers writes and reorders them (blocks are written in
+     *       eviction order, not in the order the file system issued them).
+     *       The power-loss resilience of LittleFS and SPIFFS relies on that
+     *       order, so with write-back a power loss can leave the file system
+     *       corrupted; only use it where this is acceptable.
+     */
+    bool writeBack;
+} OS_FileSystem_Cache_t;
+
+/**
+ * Statistics of the block cache
+ */
+typedef struct
+{
+    uint64_t hits;          ///< reads/writes served from the cache
+    uint64_t misses;        ///< reads that had to go to the storage
+    uint64_t evictions;     ///< blocks dropped to make room for others
+    uint64_t writeBacks;    ///< modified blocks written to the storage
+} OS_FileSystem_CacheStats_t;
+
 /**
  * Configuration struct to provide FS with callbacks with access to
  * underlying storage
@@ -222,6 +292,12 @@ typedef struct
      * specific to each FS implementation.
      */
     const OS_FileSystem_Format_t* format;
+
+    /**
+     * Configuration of the block cache; can be NULL, then all accesses go to
+     * the storage directly.
+     */
+    const OS_FileSystem_Cache_t* cache;
 } OS_FileSystem_Config_t;
 
 /**
@@ -235,9 +311,12 @@ typedef struct
  *
  * @return an error code
  * @retval OS_SUCCESS if operation succeeded
- * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid;
+ *  this includes a block cache with policy OS_FileSystem_CachePolicy_NONE or
+ *  an arena too small to hold a single block of the storage
  * @retval OS_ERROR_NOT_SUPPORTED if \p cfg is not supported
- * @retval OS_ERROR_INSUFFICIENT_SPACE if allocation of the API object failed
+ * @retval OS_ERROR_INSUFFICIENT_SPACE if allocation of the API object or of
+ *  the arena of the block cache failed
  */
 OS_Error_t
 OS_FileSystem_init(
@@ -247,6 +326,10 @@ OS_FileSystem_init(
 /**
  * @brief Free a context associated with the FileSystem API
  *
+ * If a block cache in write-back mode is used, modified blocks are NOT written
+ * to the storage, they are discarded; call OS_FileSystem_unmount() or
+ * OS_FileSystem_flush() before to keep them.
+ *
  * @param hFs (required) handle of OS FileSystem API
  *
  * @return an error code
@@ -299,6 +382,9 @@ OS_FileSystem_mount(
 /**
  * @brief Unmount storage
  *
+ * If a block cache in write-back mode is used, all modified blocks are written
+ * to the storage before unmounting.
+ *
  * @param hFs (required) handle of OS FileSystem API
  *
  * @return an error code
@@ -316,6 +402,43 @@ OS_Error_t
 OS_FileSystem_unmount(
     OS_FileSystem_Handle_t hFs);
 
+/**
+ * @brief Write all modified blocks from the block cache to the storage
+ *
+ * Does nothing if there is no block cache or it is not in write-back mode.
+ *
+ * @param hFs (required) handle of OS FileSystem API
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid
+ * @retval OS_ERROR_GENERIC if the storage reported an error while writing
+ * @retval OS_ERROR_DEVICE_INVALID if storage device is present, but can't be
+ *  used
+ * @retval OS_ERROR_DEVICE_NOT_PRESENT if storage device is not present
+ * @retval OS_ERROR_DEVICE_BUSY if storage device is present, but temporarily
+ *  not accessible
+ */
+OS_Error_t
+OS_FileSystem_flush(
+    OS_FileSystem_Handle_t hFs);
+
+/**
+ * @brief Get statistics of the block cache
+ *
+ * @param hFs (required) handle of OS FileSystem API
+ * @param stats (required) buffer for cache statistics
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid
+ * @retval OS_ERROR_NOT_SUPPORTED if the FileSystem API has no block cache
+ */
+OS_Error_t
+OS_FileSystem_getCacheStats(
+    OS_FileSystem_Handle_t      hFs,
+    OS_FileSystem_CacheStats_t* stats);
+
 /**
  * @brief Open file
  *
@@ -434,6 +557,128 @@ OS_FileSystemFile_write(
     const size_t               len,
     const void*                buffer);
 
+/**
+ * @brief Get the window in the storage dataport used for direct file I/O
+ *
+ * The window lies within the dataport of the underlying storage; its start is
+ * aligned to the storage's block size and its size is a multiple of it.
+ * OS_FileSystemFile_readDirect() places the data read into this window and
+ * OS_FileSystemFile_writeDirect() takes the data to write from there, which
+ * saves the copy between the caller's buffer and the dataport.
+ *
+ * The window does not cover the whole dataport: at least one block at its end
+ * is kept for the file system's own I/O (e.g., metadata), so this I/O never
+ * touches the window, not even during OS_FileSystemFile_readDirect() and
+ * OS_FileSystemFile_writeDirect().
+ *
+ * NOTE: The window is shared with the storage and all files of \p hFs; its
+ *       content is only valid until the next call to the FileSystem API.
+ *
+ * @param hFs (required) handle of OS FileSystem API
+ * @param buffer (required) set to the start of the window
+ * @param size (required) set to the size of the window in bytes
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid
+ * @retval OS_ERROR_NOT_SUPPORTED if the storage dataport is too small to hold
+ *  the window and the block kept for the file system's own I/O
+ */
+OS_Error_t
+OS_FileSystemFile_getDirectBuffer(
+    OS_FileSystem_Handle_t hFs,
+    void**                 buffer,
+    size_t*                size);
+
+/**
+ * @brief Read from file into the direct I/O window
+ *
+ * Same as OS_FileSystemFile_read(), but the data is placed at the start of the
+ * window returned by OS_FileSystemFile_getDirectBuffer(). Whether the blocks
+ * are read from the storage into the window without an intermediate copy
+ * depends on the file system: this requires \p offset to be aligned to the
+ * storage's block size and the file data to be stored block-aligned on the
+ * storage (e.g., FAT). Where blocks also hold file system data (e.g., the
+ * skip-list pointers of LittleFS or the page headers of SPIFFS), the data is
+ * copied into the window internally, which only saves the copy to the caller.
+ *
+ * If a block cache is configured (see OS_FileSystem_Cache_t), modified cached
+ * blocks within the range are written to the storage before it is read, so the
+ * data read is never older than what is in the cache. Parts of the range which
+ * do not cover full blocks are read through the cache like with
+ * OS_FileSystemFile_read().
+ *
+ * @param hFs (required) handle of OS FileSystem API
+ * @param hFile (required) handle of opened file
+ * @param offset (required) offset to start reading at
+ * @param len (required) amounts of bytes to read, must not exceed the size of
+ *  the direct I/O window
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_GENERIC if underlying FS implementation reported an error
+ *  during main operation
+ * @retval OS_ERROR_ABORTED if underlying FS implementation reported
+ *  inconsistencies
+ * @retval OS_ERROR_INVALID_HANDLE if file handle is invalid
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid
+ * @retval OS_ERROR_BUFFER_TOO_SMALL if \p len exceeds the size of the window
+ * @retval OS_ERROR_DEVICE_INVALID if storage device is present, but can't be
+ *  used
+ * @retval OS_ERROR_DEVICE_NOT_PRESENT if storage device is not present
+ * @retval OS_ERROR_DEVICE_BUSY if storage device is present, but temporarily
+ *  not accessible
+ */
+OS_Error_t
+OS_FileSystemFile_readDirect(
+    OS_FileSystem_Handle_t     hFs,
+    OS_FileSystemFile_Handle_t hFile,
+    const off_t                offset,
+    const size_t               len);
+
+/**
+ * @brief Write to file from the direct I/O window
+ *
+ * Same as OS_FileSystemFile_write(), but the data is taken from the start of
+ * the window returned by OS_FileSystemFile_getDirectBuffer(). Whether the
+ * blocks are written from the window to the storage without an intermediate
+ * copy depends on the file system, just like for
+ * OS_FileSystemFile_readDirect().
+ *
+ * If a block cache is configured (see OS_FileSystem_Cache_t), cached copies of
+ * the blocks written are dropped without being written back, as they are
+ * replaced entirely, so later reads cannot return stale data. Parts of the
+ * range which do not cover full blocks are written through the cache like with
+ * OS_FileSystemFile_write().
+ *
+ * @param hFs (required) handle of OS FileSystem API
+ * @param hFile (required) handle of opened file
+ * @param offset (required) offset to start writing at
+ * @param len (required) amounts of bytes to write, must not exceed the size of
+ *  the direct I/O window
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_GENERIC if underlying FS implementation reported an error
+ *  during main operation
+ * @retval OS_ERROR_ABORTED if underlying FS implementation reported
+ *  inconsistencies
+ * @retval OS_ERROR_INVALID_HANDLE if file handle is invalid
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid
+ * @retval OS_ERROR_BUFFER_TOO_SMALL if \p len exceeds the size of the window
+ * @retval OS_ERROR_DEVICE_INVALID if storage device is present, but can't be
+ *  used
+ * @retval OS_ERROR_DEVICE_NOT_PRESENT if storage device is not present
+ * @retval OS_ERROR_DEVICE_BUSY if storage device is present, but temporarily
+ *  not accessible
+ */
+OS_Error_t
+OS_FileSystemFile_writeDirect(
+    OS_FileSystem_Handle_t     hFs,
+    OS_FileSystemFile_Handle_t hFile,
+    const off_t                offset,
+    const size_t               len);
+
 /**
  * @brief Delete file
  *
@@ -40,6 +40,12 @@ OS_Keystore_free(
 /**
  * @brief Imports a key blob into the Keystore
  *
+ * Crypto API keys should be stored in the encoding of
+ * OS_CryptoKey_exportCompact(), which is much smaller than a raw
+ * OS_CryptoKey_Data_t. Keystores may still hold raw OS_CryptoKey_Data_t blobs
+ * stored earlier; a loader tells them apart by the first byte, which is
+ * OS_CryptoKey_COMPACT_MAGIC only for the compact encoding.
+ *
  * @param hKeystore  keystore handle
  * @param name       name of the key to import
  * @param keyData    buffer containing the key blob
@@ -80,6 +80,12 @@ typedef enum
      */
     OS_Tls_CIPHERSUITE_ECDHE_RSA_WITH_AES_128_GCM_SHA256,
 
+    /**
+     * Use ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256 ciphersuite; preferable on
+     * CPUs without AES instructions.
+     */
+    OS_Tls_CIPHERSUITE_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256,
+
 /// @cond INTERNAL
 //------------------------------------------------------------------------------
     __OS_Tls_CIPHERSUITE_MAX
@@ -39,7 +39,12 @@ typedef enum
     /**
      * Use Elliptic Curve Diffie-Hellman(-Merkle) key exchange.
      */
-    OS_CryptoAgreement_ALG_ECDH
+    OS_CryptoAgreement_ALG_ECDH,
+
+    /**
+     * Use X25519 key exchange (RFC 7748).
+     */
+    OS_CryptoAgreement_ALG_X25519
 } OS_CryptoAgreement_Alg_t;
 
 ///@cond INTERNAL
@@ -32,6 +32,14 @@
 #define OS_CryptoCipher_SIZE_AES_GCM_IV        12
 #define OS_CryptoCipher_SIZE_AES_GCM_TAG_MIN   4
 #define OS_CryptoCipher_SIZE_AES_GCM_TAG_MAX   OS_CryptoCipher_SIZE_AES_BLOCK
+#define OS_CryptoCipher_SIZE_CHACHA20_POLY1305_IV    12
+#define OS_CryptoCipher_SIZE_CHACHA20_POLY1305_TAG   16
+
+/**
+ * Alignment of the chunks an oversized input to OS_CryptoCipher_process() is
+ * split into when it is processed by a remote instance.
+ */
+#define OS_CryptoCipher_SIZE_CHUNK_ALIGN       OS_CryptoCipher_SIZE_AES_BLOCK
 
 /**
  * Type and mode of encryption algorithm to use for CIPHER object.
@@ -80,6 +88,16 @@ typedef enum
      * Use AES in CTR mode for decryption.
      */
     OS_CryptoCipher_ALG_AES_CTR_DEC,
+
+    /**
+     * Use ChaCha20-Poly1305 AEAD (RFC 8439) for encryption.
+     */
+    OS_CryptoCipher_ALG_CHACHA20_POLY1305_ENC,
+
+    /**
+     * Use ChaCha20-Poly1305 AEAD (RFC 8439) for decryption.
+     */
+    OS_CryptoCipher_ALG_CHACHA20_POLY1305_DEC,
 } OS_CryptoCipher_Alg_t;
 
 /// @cond INTERNAL
@@ -96,6 +114,11 @@ typedef OS_Crypto_Object_t* OS_CryptoCipher_Handle_t;
  * Some algorithms do require an IV:
  * - AES-GCM requires 12 bytes of IV
  * - AES-CBC requires 16 bytes of IV
+ * - ChaCha20-Poly1305 requires 12 bytes of IV (nonce) and a ChaCha20 key
+ *
+ * The expanded key schedule (and for AES-GCM the GHASH tables) is computed
+ * once per KEY object and kept with it, so initializing multiple CIPHER
+ * objects with the same \p hKey does not repeat this work.
  *
  * @param hCipher (required) pointer to handle of OS Crypto CIPHER object
  * @param hCrypto (required) handle of OS Crypto API
@@ -124,6 +147,30 @@ OS_CryptoCipher_init(
     const void*                 iv,
     const size_t                ivSize);
 
+/**
+ * @brief Re-initialize a CIPHER object with a new IV.
+ *
+ * Resets the CIPHER object to the state right after OS_CryptoCipher_init(),
+ * but with a different IV; key and algorithm stay the same. This is much
+ * cheaper than freeing and initializing a new CIPHER object, e.g. when
+ * encrypting many short records with the same key.
+ *
+ * @param hCipher (required) handle of OS Crypto CIPHER object
+ * @param iv (optional) initialization vector required for some ciphers
+ * @param ivSize (optional) length of initialization vector
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid,
+ *  with the same rules for \p iv as for OS_CryptoCipher_init()
+ * @retval OS_ERROR_ABORTED if setting the IV internally failed
+ */
+OS_Error_t
+OS_CryptoCipher_reinit(
+    OS_CryptoCipher_Handle_t hCipher,
+    const void*              iv,
+    const size_t             ivSize);
+
 /**
  * @brief Finish CIPHER object.
  *
@@ -148,6 +195,22 @@ OS_CryptoCipher_free(
  * - AES-ECB and AES-CBC require all inputs to be aligned to 16 byte blocks.
  * - AES-GCM can deal with non-aligned blocks, but only in the last call to
  *           this function.
+ * - ChaCha20-Poly1305 has the same restriction as AES-GCM.
+ *
+ * If the CIPHER object resides in a remote instance (OS_Crypto_MODE_CLIENT or
+ * OS_Crypto_MODE_KEY_SWITCH with a remote key), \p inputSize is not limited by
+ * the size of the dataport: the input is transparently split into chunks of
+ * OS_CryptoCipher_SIZE_CHUNK_ALIGN aligned size, which are processed in
+ * sequence so the result is the same as processing the input in one piece.
+ * Only the last chunk may be non-aligned, with the restrictions given above.
+ * If a chunk other than the first one fails, the preceding chunks have already
+ * advanced the state of the CIPHER object and written their output:
+ * \p outputSize is then set to the amount of bytes written by them and the
+ * CIPHER object is unusable, all further calls except OS_CryptoCipher_free()
+ * fail with OS_ERROR_ABORTED.
+ *
+ * If the CIPHER object resides in the local library instance, \p inputSize is
+ * not limited either; the input is processed in one piece.
  *
  * @param hCipher (required) handle of OS Crypto CIPHER object
  * @param input (required) input data
@@ -155,23 +218,72 @@ OS_CryptoCipher_free(
  * @param output (required) buffer for resulting output data
  * @param outputSize (required) size of output buffer, will be set to actual
  *  amount of bytes written if function succeeds (or to the minimum size if it
- *  fails)
+ *  fails before any output was written, see above for failing chunks)
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid,
+ *  this includes passing \p inputSize that is not aligned with the underlying
+ *  blocksize or an \p outputSize smaller than \p inputSize
+ * @retval OS_ERROR_ABORTED if the cryptographic operation failed (including
+ *  the failure of a chunk) or if process was called without calling start
+ *  (e.g., for GCM mode) or if process is called after the CIPHER was already
+ *  finalized or became unusable
+ */
+OS_Error_t
+OS_CryptoCipher_process(
+    OS_CryptoCipher_Handle_t hCipher,
+    const void*              input,
+    const size_t             inputSize,
+    void*                    output,
+    size_t*                  outputSize);
+
+/**
+ * @brief Process data blocks with the CIPHER object without copying the output.
+ *
+ * Works like OS_CryptoCipher_process(), but instead of copying the output into
+ * a buffer of the caller, \p output is set to point to the buffer the output
+ * was produced in:
+ * - If the CIPHER object resides in a remote instance, this is the dataport
+ *   shared with that instance, so e.g. ciphertext can be passed on to a socket
+ *   or file without an intermediate copy.
+ * - If the CIPHER object resides in the local library instance, this is a
+ *   scratch buffer of OS_DATAPORT_DEFAULT_SIZE bytes owned by the Crypto API
+ *   instance, allocated via OS_Crypto_Memory_t on first use. When using
+ *   OS_CRYPTO_MEMORY_POOL, the pool needs a class of at least this size (as
+ *   in OS_CryptoPool_CLASSES_DEFAULT) or fallback enabled.
+ *
+ * In both cases the output is only valid until the next call to the Crypto API
+ * instance \p hCipher belongs to, as the buffer is shared by all its objects;
+ * the caller must not write to it.
+ *
+ * @param hCipher (required) handle of OS Crypto CIPHER object
+ * @param input (required) input data
+ * @param inputSize (required) length of input data; unlike with
+ *  OS_CryptoCipher_process(), the input is not split into chunks, so it must
+ *  fit into the dataport or scratch buffer
+ * @param output (required) set to the resulting output data
+ * @param outputSize (required) set to the amount of bytes of output data
  *
  * @return an error code
  * @retval OS_SUCCESS if operation succeeded
  * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid,
  *  this includes passing \p inputSize that is not aligned with the underlying
- *  blocksize or an oversized buffer
+ *  blocksize
+ * @retval OS_ERROR_BUFFER_TOO_SMALL if the input or output does not fit into
+ *  the dataport or scratch buffer
+ * @retval OS_ERROR_INSUFFICIENT_SPACE if the scratch buffer could not be
+ *  allocated
  * @retval OS_ERROR_ABORTED if the cryptographic operation failed or if process
  *  was called without calling start (e.g., for GCM mode) or if process is called
  *  after the CIPHER was already finalized
  */
 OS_Error_t
-OS_CryptoCipher_process(
+OS_CryptoCipher_processMapped(
     OS_CryptoCipher_Handle_t hCipher,
     const void*              input,
     const size_t             inputSize,
-    void*                    output,
+    const void**             output,
     size_t*                  outputSize);
 
 /**
@@ -179,7 +291,7 @@ OS_CryptoCipher_process(
  *
  * This functions starts a computation for certain algorithms. One example is
  * AES-GCM, where besides encrypting data, additional data can be added for
- * authentication.
+ * authentication. ChaCha20-Poly1305 is used the same way.
  *
  * @param hCipher (required) handle of OS Crypto CIPHER object
  * @param input (optional) input data
@@ -209,7 +321,7 @@ OS_CryptoCipher_start(
  * it with a tag that must be provided in \p tag.
  *
  * For GCM in encryption mode, the \p tagSize must be >= 4, as the resulting tag
- * can be shortened if desired.
+ * can be shortened if desired. For ChaCha20-Poly1305 the tag is always 16 bytes.
  *
  * @param hCipher (required) handle of OS Crypto CIPHER object
  * @param tag (required) input/output buffer for final operation
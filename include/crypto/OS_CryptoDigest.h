@@ -30,6 +30,18 @@
  * Length of SHA256 hash in bytes.
  */
 #define OS_CryptoDigest_SIZE_SHA256  32
+/**
+ * Length of SHA384 hash in bytes.
+ */
+#define OS_CryptoDigest_SIZE_SHA384  48
+/**
+ * Length of SHA512 hash in bytes.
+ */
+#define OS_CryptoDigest_SIZE_SHA512  64
+/**
+ * Length of BLAKE2b hash in bytes.
+ */
+#define OS_CryptoDigest_SIZE_BLAKE2B 64
 
 /**
  * These need to be set to these exact values to match values expected by the
@@ -47,7 +59,23 @@ typedef enum
     /**
      * Use SHA256 hash.
      */
-    OS_CryptoDigest_ALG_SHA256     = 6
+    OS_CryptoDigest_ALG_SHA256     = 6,
+
+    /**
+     * Use SHA384 hash.
+     */
+    OS_CryptoDigest_ALG_SHA384     = 7,
+
+    /**
+     * Use SHA512 hash; on 64-bit targets this is faster per byte than SHA256.
+     */
+    OS_CryptoDigest_ALG_SHA512     = 8,
+
+    /**
+     * Use BLAKE2b hash with 64 byte output; this is not known to the underlying
+     * library and thus placed outside of its range of values.
+     */
+    OS_CryptoDigest_ALG_BLAKE2B    = 32
 } OS_CryptoDigest_Alg_t;
 
 /// @cond INTERNAL
@@ -162,4 +190,65 @@ OS_CryptoDigest_finalize(
     void*                    digest,
     size_t*                  digestSize);
 
+/**
+ * @brief Finish computation to produce digest/hash value without copying it.
+ *
+ * Works like OS_CryptoDigest_finalize(), but instead of copying the digest/hash
+ * value into a buffer of the caller, \p digest is set to point to the buffer it
+ * was produced in: the dataport if the DIGEST object resides in a remote
+ * instance, otherwise a buffer of OS_CryptoDigest_SIZE_SHA512 bytes within the
+ * DIGEST object itself, so no additional memory is allocated.
+ * The value is only valid until the next call to the Crypto API instance
+ * \p hDigest belongs to; the caller must not write to it.
+ *
+ * @param hDigest (required) handle of OS Crypto DIGEST object
+ * @param digest (required) set to the digest/hash value
+ * @param digestSize (required) set to the amount of bytes of the digest/hash
+ *  value
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid
+ * @retval OS_ERROR_ABORTED if the digest could not be produced or if no
+ *  blocks were processed before finalizing or if finalize was already called
+ */
+OS_Error_t
+OS_CryptoDigest_finalizeMapped(
+    OS_CryptoDigest_Handle_t hDigest,
+    const void**             digest,
+    size_t*                  digestSize);
+
+/**
+ * @brief Compute the digest/hash value of a buffer in a single call.
+ *
+ * This function is equivalent to calling init(), process(), finalize() and
+ * free() in sequence, but does not need a DIGEST object. In
+ * OS_Crypto_MODE_CLIENT it takes a single RPC; in OS_Crypto_MODE_KEY_SWITCH it
+ * is executed in the local library, as no key is involved.
+ *
+ * @param hCrypto (required) handle of OS Crypto API
+ * @param algorithm (required) DIGEST algorithm to use
+ * @param data (required) data to process
+ * @param dataSize (required) length of data
+ * @param digest (required) buffer to write digest/hash value to
+ * @param digestSize (required) size of buffer, will be set to the amount
+ *  of bytes written to \p digest (or the minimum size if it fails due too small
+ *  buffer)
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid,
+ *  this includes passing an oversized or too small buffer
+ * @retval OS_ERROR_NOT_SUPPORTED if \p algorithm is not supported
+ * @retval OS_ERROR_ABORTED if the digest could not be produced
+ */
+OS_Error_t
+OS_CryptoDigest_oneShot(
+    const OS_Crypto_Handle_t    hCrypto,
+    const OS_CryptoDigest_Alg_t algorithm,
+    const void*                 data,
+    const size_t                dataSize,
+    void*                       digest,
+    size_t*                     digestSize);
+
 /** @} */
\ No newline at end of file
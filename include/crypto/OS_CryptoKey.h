@@ -35,8 +35,28 @@
 #define OS_CryptoKey_SIZE_RSA_MIN      16      ///< min 128 bit
 #define OS_CryptoKey_SIZE_DH_MAX       512     ///< max 4096 bit
 #define OS_CryptoKey_SIZE_DH_MIN       8       ///< min 64 bit
-#define OS_CryptoKey_SIZE_ECC          32      ///< always 256 bit
+#define OS_CryptoKey_SIZE_ECC          32      ///< max 256 bit
 #define OS_CryptoKey_SIZE_MAC_MAX      1024    ///< max 8096 bit
+#define OS_CryptoKey_SIZE_CHACHA20     32      ///< always 256 bit
+#define OS_CryptoKey_SIZE_CURVE25519   32      ///< always 256 bit
+
+/**
+ * Sizes of the compact key encoding, see OS_CryptoKey_exportCompact().
+ */
+#define OS_CryptoKey_SIZE_COMPACT_HDR      6    ///< magic, version, type, attribs, count, flags
+#define OS_CryptoKey_SIZE_COMPACT_FIELD    3    ///< tag and length of a field
+#define OS_CryptoKey_SIZE_COMPACT_MAX      \
+    (OS_CryptoKey_SIZE_COMPACT_HDR + sizeof(OS_CryptoKey_Data_t))
+
+/**
+ * First byte of the compact key encoding; it can never be the first byte of a
+ * raw OS_CryptoKey_Data_t, as that holds the (small) OS_CryptoKey_Type_t.
+ */
+#define OS_CryptoKey_COMPACT_MAGIC         0xCE
+/**
+ * Version of the compact key encoding written by OS_CryptoKey_exportCompact().
+ */
+#define OS_CryptoKey_COMPACT_VERSION       1
 
 /**
  * Type of well-known crypto parameters to load
@@ -136,9 +156,86 @@ typedef enum
     /**
      * Key for MAC computation
      */
-    OS_CryptoKey_TYPE_MAC
+    OS_CryptoKey_TYPE_MAC,
+
+    /**
+     * Key for use with ChaCha20-Poly1305 encryption/decryption; can only be
+     * 256 bits.
+     */
+    OS_CryptoKey_TYPE_CHACHA20,
+
+    /**
+     * Key on Edwards25519 curve for Ed25519 signing; can only be 256 bits.
+     */
+    OS_CryptoKey_TYPE_ED25519_PRV,
+
+    /**
+     * Key on Edwards25519 curve for Ed25519 verification; can only be 256 bits.
+     */
+    OS_CryptoKey_TYPE_ED25519_PUB,
+
+    /**
+     * Key on Curve25519 for X25519 private operations; can only be 256 bits.
+     */
+    OS_CryptoKey_TYPE_X25519_PRV,
+
+    /**
+     * Key on Curve25519 for X25519 public operations; can only be 256 bits.
+     */
+    OS_CryptoKey_TYPE_X25519_PUB,
+
+    /**
+     * Key on SECP192r1 Elliptic Curve for private operations; can only be 192 bits.
+     */
+    OS_CryptoKey_TYPE_SECP192R1_PRV,
+
+    /**
+     * Key on SECP192r1 Elliptic Curve for public operations; can only be 192 bits.
+     */
+    OS_CryptoKey_TYPE_SECP192R1_PUB,
+
+    /**
+     * Key on SECP224r1 Elliptic Curve for private operations; can only be 224 bits.
+     */
+    OS_CryptoKey_TYPE_SECP224R1_PRV,
+
+    /**
+     * Key on SECP224r1 Elliptic Curve for public operations; can only be 224 bits.
+     */
+    OS_CryptoKey_TYPE_SECP224R1_PUB
 } OS_CryptoKey_Type_t;
 
+/**
+ * Tags of the fields in the compact key encoding; each tag corresponds to a
+ * byte array in the respective OS_CryptoKey_XXX_t struct.
+ */
+typedef enum
+{
+    OS_CryptoKey_TAG_NONE = 0,
+    OS_CryptoKey_TAG_AES_BYTES,     ///< OS_CryptoKey_Aes_t.bytes
+    OS_CryptoKey_TAG_MAC_BYTES,     ///< OS_CryptoKey_Mac_t.bytes
+    OS_CryptoKey_TAG_RSA_N,         ///< OS_CryptoKey_RsaRub_t.nBytes
+    OS_CryptoKey_TAG_RSA_E,         ///< OS_CryptoKey_RsaRub_t/RsaRrv_t.eBytes
+    OS_CryptoKey_TAG_RSA_D,         ///< OS_CryptoKey_RsaRrv_t.dBytes
+    OS_CryptoKey_TAG_RSA_P,         ///< OS_CryptoKey_RsaRrv_t.pBytes
+    OS_CryptoKey_TAG_RSA_Q,         ///< OS_CryptoKey_RsaRrv_t.qBytes
+    OS_CryptoKey_TAG_DH_P,          ///< OS_CryptoKey_DhParams_t.pBytes
+    OS_CryptoKey_TAG_DH_G,          ///< OS_CryptoKey_DhParams_t.gBytes
+    OS_CryptoKey_TAG_DH_GX,         ///< OS_CryptoKey_DhPub_t.gxBytes
+    OS_CryptoKey_TAG_DH_X,          ///< OS_CryptoKey_DhPrv_t.xBytes
+    OS_CryptoKey_TAG_ECC_QX,        ///< OS_CryptoKey_Secp256r1Pub_t.qxBytes,
+                                    ///< also for SECP192r1/SECP224r1
+    OS_CryptoKey_TAG_ECC_QY,        ///< OS_CryptoKey_Secp256r1Pub_t.qyBytes,
+                                    ///< also for SECP192r1/SECP224r1
+    OS_CryptoKey_TAG_ECC_D,         ///< OS_CryptoKey_Secp256r1Prv_t.dBytes,
+                                    ///< also for SECP192r1/SECP224r1
+    OS_CryptoKey_TAG_CHACHA20,      ///< OS_CryptoKey_ChaCha20_t.bytes
+    OS_CryptoKey_TAG_ED25519_PRV,   ///< OS_CryptoKey_Ed25519Prv_t.dBytes
+    OS_CryptoKey_TAG_ED25519_PUB,   ///< OS_CryptoKey_Ed25519Pub_t.aBytes
+    OS_CryptoKey_TAG_X25519_PRV,    ///< OS_CryptoKey_X25519Prv_t.dBytes
+    OS_CryptoKey_TAG_X25519_PUB,    ///< OS_CryptoKey_X25519Pub_t.uBytes
+} OS_CryptoKey_Tag_t;
+
 /// @cond INTERNAL
 //------------------------------------------------------------------------------
 typedef OS_Crypto_Object_t* OS_CryptoKey_Handle_t;
@@ -167,6 +264,13 @@ typedef struct
 
 /**
  * Struct for RSA private key data.
+ *
+ * The CRT values (dP, dQ, qInv) and the Montgomery contexts of p, q and n are
+ * derived from this once, when the KEY object is imported or generated, and
+ * kept with the KEY object for all following private operations.
+ *
+ * Private operations are blinded; the blinding pair is drawn once and then
+ * refreshed by squaring it for every operation.
  */
 typedef struct
 {
@@ -221,6 +325,42 @@ typedef struct
     uint32_t dLen;
 } OS_CryptoKey_Secp256r1Prv_t;
 
+/**
+ * Struct for Ed25519 public key data (RFC 8032).
+ */
+typedef struct
+{
+    uint8_t aBytes[OS_CryptoKey_SIZE_CURVE25519]; ///< encoded point A
+    uint32_t aLen;
+} OS_CryptoKey_Ed25519Pub_t;
+
+/**
+ * Struct for Ed25519 private key data (RFC 8032).
+ */
+typedef struct
+{
+    uint8_t dBytes[OS_CryptoKey_SIZE_CURVE25519]; ///< private key (seed)
+    uint32_t dLen;
+} OS_CryptoKey_Ed25519Prv_t;
+
+/**
+ * Struct for X25519 public key data (RFC 7748).
+ */
+typedef struct
+{
+    uint8_t uBytes[OS_CryptoKey_SIZE_CURVE25519]; ///< u-coordinate
+    uint32_t uLen;
+} OS_CryptoKey_X25519Pub_t;
+
+/**
+ * Struct for X25519 private key data (RFC 7748).
+ */
+typedef struct
+{
+    uint8_t dBytes[OS_CryptoKey_SIZE_CURVE25519]; ///< private scalar
+    uint32_t dLen;
+} OS_CryptoKey_X25519Prv_t;
+
 /**
  * Struct for shared DH parameters.
  */
@@ -261,6 +401,15 @@ typedef struct
     uint32_t len;                               ///< amount of bytes
 } OS_CryptoKey_Mac_t;
 
+/**
+ * Struct for a ChaCha20 Key.
+ */
+typedef struct
+{
+    uint8_t bytes[OS_CryptoKey_SIZE_CHACHA20];  ///< key bytes
+    uint32_t len;                               ///< amount of bytes
+} OS_CryptoKey_ChaCha20_t;
+
 /**
  * Struct for attributes associated with every key.
  */
@@ -378,6 +527,42 @@ typedef struct
             OS_CryptoKey_Secp256r1Pub_t pub;
         } secp256r1;
 
+        /**
+         * Use for keys of SECP192r1 type; coordinates and scalar are 24 bytes
+         */
+        union
+        {
+            OS_CryptoKey_Secp256r1Prv_t prv;
+            OS_CryptoKey_Secp256r1Pub_t pub;
+        } secp192r1;
+
+        /**
+         * Use for keys of SECP224r1 type; coordinates and scalar are 28 bytes
+         */
+        union
+        {
+            OS_CryptoKey_Secp256r1Prv_t prv;
+            OS_CryptoKey_Secp256r1Pub_t pub;
+        } secp224r1;
+
+        /**
+         * Use for keys of ED25519 type
+         */
+        union
+        {
+            OS_CryptoKey_Ed25519Prv_t prv;
+            OS_CryptoKey_Ed25519Pub_t pub;
+        } ed25519;
+
+        /**
+         * Use for keys of X25519 type
+         */
+        union
+        {
+            OS_CryptoKey_X25519Prv_t prv;
+            OS_CryptoKey_X25519Pub_t pub;
+        } x25519;
+
         /**
          * Use for keys of DH type
          */
@@ -405,6 +590,11 @@ typedef struct
          * Use for keys of MAC type
          */
         OS_CryptoKey_Mac_t mac;
+
+        /**
+         * Use for keys of CHACHA20 type
+         */
+        OS_CryptoKey_ChaCha20_t chacha20;
     } data;
 } OS_CryptoKey_Data_t;
 
@@ -529,6 +719,10 @@ OS_CryptoKey_generate(
  *  };
  *  \endcode
  *
+ * If the instance which sets up the key has a key cache (see
+ * OS_Crypto_KeyCache_t) and holds a key with identical \p keyData, the
+ * returned handle refers to that key and no new key is set up.
+ *
  * @param hKey (required) pointer to handle of OS Crypto KEY object
  * @param hCrypto (required) handle of OS Crypto API
  * @param keyData (required) buffer for key material to import
@@ -577,7 +771,9 @@ OS_CryptoKey_makePublic(
  * @brief Finish a KEY object.
  *
  * This function frees the memory associated with the KEY object and zeroizes
- * any sensitive material that was stored internally.
+ * any sensitive material that was stored internally, including key schedules
+ * cached for CIPHER objects. A key held by a key cache (see
+ * OS_Crypto_KeyCache_t) is only zeroized once it is evicted from the cache.
  *
  * @param hKey (required) handle of OS Crypto KEY object
  *
@@ -607,6 +803,77 @@ OS_CryptoKey_export(
     const OS_CryptoKey_Handle_t hKey,
     OS_CryptoKey_Data_t*        keyData);
 
+/**
+ * @brief Import data into KEY object from a compact encoding.
+ *
+ * Same as OS_CryptoKey_import(), but takes the key in the compact encoding
+ * produced by OS_CryptoKey_exportCompact(), so only the bytes actually used
+ * by the key need to be passed (e.g., through the dataport).
+ *
+ * @param hKey (required) pointer to handle of OS Crypto KEY object
+ * @param hCrypto (required) handle of OS Crypto API
+ * @param buf (required) buffer holding the encoded key
+ * @param bufSize (required) size of the encoded key
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid;
+ *  this includes a malformed encoding (e.g., wrong magic byte, unknown or
+ *  duplicate tags, field lengths exceeding \p bufSize or the size of the
+ *  respective field) or a key that would be rejected by OS_CryptoKey_import()
+ * @retval OS_ERROR_NOT_SUPPORTED if the version of the encoding is unknown
+ * @retval OS_ERROR_INSUFFICIENT_SPACE if allocation of the key failed
+ */
+OS_Error_t
+OS_CryptoKey_importCompact(
+    OS_CryptoKey_Handle_t*   hKey,
+    const OS_Crypto_Handle_t hCrypto,
+    const void*              buf,
+    const size_t             bufSize);
+
+/**
+ * @brief Export data from KEY object into a compact encoding.
+ *
+ * Same as OS_CryptoKey_export(), but instead of the fixed-size
+ * OS_CryptoKey_Data_t only the bytes actually used by the key are written.
+ * The encoding is a header followed by one TLV field per byte array of the key:
+ *
+ * | offset | size | content                                               |
+ * |--------|------|-------------------------------------------------------|
+ * | 0      | 1    | OS_CryptoKey_COMPACT_MAGIC                            |
+ * | 1      | 1    | OS_CryptoKey_COMPACT_VERSION                          |
+ * | 2      | 1    | OS_CryptoKey_Type_t of the key                        |
+ * | 3      | 1    | attribs: bit 0 is keepLocal, other bits must be 0     |
+ * | 4      | 1    | number of fields that follow                          |
+ * | 5      | 1    | OS_CryptoKey_Flag_t bits 0..7 of the key's flags      |
+ * | 6      | 1    | field: OS_CryptoKey_Tag_t                             |
+ * | 7      | 2    | field: length of value in bytes (little endian)       |
+ * | 9      | len  | field: value                                          |
+ * | ...    |      | further fields                                        |
+ *
+ * The magic byte allows to tell the encoding apart from a raw
+ * OS_CryptoKey_Data_t (e.g., when loading keys from a keystore); later
+ * versions of the encoding will increase the version byte.
+ *
+ * @param hKey (required) handle of OS Crypto KEY object
+ * @param buf (required) buffer for the encoded key
+ * @param bufSize (required) size of buffer, will be set to the amount of
+ *  bytes written (or the minimum size if it fails due to too small buffer)
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid;
+ *  this includes a key with flags above bit 7 set, which cannot be represented
+ *  in the encoding
+ * @retval OS_ERROR_BUFFER_TOO_SMALL if \p bufSize is too small
+ * @retval OS_ERROR_OPERATION_DENIED if the key cannot be exported
+ */
+OS_Error_t
+OS_CryptoKey_exportCompact(
+    const OS_CryptoKey_Handle_t hKey,
+    void*                       buf,
+    size_t*                     bufSize);
+
 /**
  * @brief Get shared parameters from KEY.
  *
@@ -32,6 +32,14 @@
  * The output size of HMAC-SHA256 in bytes.
  */
 #define OS_CryptoMac_SIZE_HMAC_SHA256  32
+/**
+ * The output size of HMAC-SHA384 in bytes.
+ */
+#define OS_CryptoMac_SIZE_HMAC_SHA384  48
+/**
+ * The output size of HMAC-SHA512 in bytes.
+ */
+#define OS_CryptoMac_SIZE_HMAC_SHA512  64
 
 /**
  * Type of MAC algorithm to use.
@@ -49,6 +57,16 @@ typedef enum
      * Use HMAC with SHA256 as hash algorithm.
      */
     OS_CryptoMac_ALG_HMAC_SHA256,
+
+    /**
+     * Use HMAC with SHA384 as hash algorithm.
+     */
+    OS_CryptoMac_ALG_HMAC_SHA384,
+
+    /**
+     * Use HMAC with SHA512 as hash algorithm.
+     */
+    OS_CryptoMac_ALG_HMAC_SHA512,
 } OS_CryptoMac_Alg_t;
 
 /// @cond INTERNAL
@@ -144,4 +162,39 @@ OS_CryptoMac_finalize(
     void*                 auth,
     size_t*               authSize);
 
+/**
+ * @brief Compute the authentication code of a buffer in a single call.
+ *
+ * This function is equivalent to calling init(), process(), finalize() and
+ * free() in sequence, but does not need a MAC object. In OS_Crypto_MODE_CLIENT
+ * it takes a single RPC; in OS_Crypto_MODE_KEY_SWITCH it is executed wherever
+ * \p hKey resides.
+ *
+ * @param hCrypto (required) handle of OS Crypto API
+ * @param hKey (required) handle of OS Crypto Key object
+ * @param algorithm (required) MAC algorithm to use
+ * @param data (required) data to process
+ * @param dataSize (required) length of data
+ * @param auth (required) buffer to write authentication code to
+ * @param authSize (required) size of buffer, will be set to the amount of bytes
+ *  written to \p auth (or the minimum size if it fails due too small buffer)
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid,
+ *  this includes passing the wrong type of key or algorithm or an oversized
+ *  or too small buffer
+ * @retval OS_ERROR_NOT_SUPPORTED if \p algorithm is not supported
+ * @retval OS_ERROR_ABORTED if \p auth could not be produced
+ */
+OS_Error_t
+OS_CryptoMac_oneShot(
+    const OS_Crypto_Handle_t    hCrypto,
+    const OS_CryptoKey_Handle_t hKey,
+    const OS_CryptoMac_Alg_t    algorithm,
+    const void*                 data,
+    const size_t                dataSize,
+    void*                       auth,
+    size_t*                     authSize);
+
 /** @} */
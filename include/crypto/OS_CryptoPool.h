@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+/**
+ * @file
+ * @ingroup OS_CryptoPool
+ */
+
+/**
+ * @defgroup OS_CryptoPool Crypto API library pool allocator
+ * @{
+ * @ingroup OS_Crypto
+ * @brief OS Crypto API library fixed-size-class pool allocator
+ *
+ * The pool serves allocations from a fixed arena, which is split into blocks
+ * of a few size classes. Every allocation takes a block of the smallest class
+ * it fits into, so long running components do not fragment their heap with
+ * the many short lived objects the Crypto API creates.
+ *
+ * OS_CryptoPool_calloc() and OS_CryptoPool_release() are thread-safe and can
+ * be called concurrently, e.g., by Crypto API instances of different threads:
+ * the free blocks of each class are kept in a lock-free list, so no lock is
+ * taken on the allocation path. Only the tracking done in debug mode is
+ * serialized by a lock. OS_CryptoPool_init() and OS_CryptoPool_free() must
+ * not run concurrently with any other function of the pool.
+ *
+ * As OS_Crypto_Memory_t does not carry a context, there is one pool per
+ * component; it can be plugged into the Crypto API like this:
+ *  \code{.c}
+ *  static const OS_CryptoPool_Class_t classes[] = OS_CryptoPool_CLASSES_DEFAULT;
+ *  static const OS_CryptoPool_Config_t poolCfg = {
+ *      .classes    = classes,
+ *      .numClasses = sizeof(classes) / sizeof(*classes),
+ *  };
+ *  static OS_Crypto_Config_t cfg = {
+ *      .mode   = OS_Crypto_MODE_LIBRARY,
+ *      .memory = OS_CRYPTO_MEMORY_POOL,
+ *      ...
+ *  };
+ *
+ *  OS_CryptoPool_init(&poolCfg);
+ *  OS_Crypto_init(&hCrypto, &cfg);
+ *  \endcode
+ */
+
+#pragma once
+
+#include "OS_Dataport.h"
+#include "OS_Error.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * Maximum number of size classes of the pool.
+ */
+#define OS_CryptoPool_CLASSES_MAX   8
+
+/**
+ * A size class of the pool.
+ */
+typedef struct
+{
+    size_t size;    ///< size of each block in bytes
+    size_t count;   ///< number of blocks
+} OS_CryptoPool_Class_t;
+
+/**
+ * Size classes suited for typical use of the Crypto API: small blocks for the
+ * API objects (e.g., DIGEST, MAC, CIPHER), mid-sized ones for the internal
+ * state of ciphers and ECC keys, large blocks for RSA/DH key data and a few
+ * blocks for the scratch buffer used by OS_CryptoCipher_processMapped().
+ */
+#define OS_CryptoPool_CLASSES_DEFAULT                       \
+{                                                           \
+    { .size = 64,                          .count = 64 },   \
+    { .size = 256,                         .count = 32 },   \
+    { .size = 1024,                        .count = 16 },   \
+    { .size = sizeof(OS_CryptoKey_Data_t), .count = 8  },   \
+    { .size = OS_DATAPORT_DEFAULT_SIZE,    .count = 2  },   \
+}
+
+/**
+ * Configuration of the pool.
+ */
+typedef struct
+{
+    /**
+     * Size classes of the pool, sorted by ascending size
+     */
+    const OS_CryptoPool_Class_t* classes;
+
+    /**
+     * Number of entries in \p classes, at most OS_CryptoPool_CLASSES_MAX
+     */
+    size_t numClasses;
+
+    /**
+     * Arena to carve the blocks from; can be NULL, then the required amount
+     * of memory is allocated once during OS_CryptoPool_init()
+     */
+    void* arena;
+
+    /**
+     * Size of the arena in bytes
+     */
+    size_t arenaSize;
+
+    /**
+     * If set, allocations which do not fit into any class or whose class is
+     * exhausted are served by the standard calloc()/free(); otherwise they fail
+     */
+    bool fallback;
+
+    /**
+     * If set, all allocations are tracked so OS_CryptoPool_checkLeaks() can
+     * report blocks that are still in use
+     */
+    bool debug;
+} OS_CryptoPool_Config_t;
+
+/**
+ * Statistics of the pool.
+ */
+typedef struct
+{
+    struct
+    {
+        size_t size;        ///< size of each block in bytes
+        size_t count;       ///< number of blocks
+        size_t inUse;       ///< number of blocks currently allocated
+        size_t highWater;   ///< maximum number of blocks allocated at once
+        size_t failed;      ///< allocations that found this class exhausted
+    } classes[OS_CryptoPool_CLASSES_MAX];
+    size_t numClasses;
+    size_t fallbacks;       ///< allocations served by the standard allocator
+} OS_CryptoPool_Stats_t;
+
+/**
+ * Assign the pool to the memory configuration of the Crypto API.
+ */
+#define OS_CRYPTO_MEMORY_POOL {                 \
+    .calloc     = OS_CryptoPool_calloc,         \
+    .free       = OS_CryptoPool_release,        \
+    .checkLeaks = OS_CryptoPool_checkLeaks      \
+}
+
+/**
+ * @brief Set up the pool
+ *
+ * @param cfg (required) pointer to configuration
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid
+ * @retval OS_ERROR_INVALID_STATE if the pool is already set up
+ * @retval OS_ERROR_INSUFFICIENT_SPACE if the arena is too small for the
+ *  configured classes or could not be allocated
+ */
+OS_Error_t
+OS_CryptoPool_init(
+    const OS_CryptoPool_Config_t* cfg);
+
+/**
+ * @brief Tear down the pool
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_STATE if the pool is not set up or blocks are still
+ *  in use
+ */
+OS_Error_t
+OS_CryptoPool_free(void);
+
+/**
+ * @brief Allocate zeroed memory for \p n elements of \p size bytes from the pool
+ *
+ * @return pointer to the memory or NULL if the allocation failed
+ */
+void*
+OS_CryptoPool_calloc(
+    size_t n,
+    size_t size);
+
+/**
+ * @brief Return memory obtained by OS_CryptoPool_calloc() to the pool
+ *
+ * The memory is zeroized before it is returned to the pool.
+ */
+void
+OS_CryptoPool_release(
+    void* ptr);
+
+/**
+ * @brief Report blocks that are still in use
+ *
+ * In debug mode, every block still in use is logged with its size class. This
+ * is called by OS_Crypto_free() when the pool is assigned with
+ * OS_CRYPTO_MEMORY_POOL; as there is only one pool per component, blocks of
+ * other Crypto API instances using the pool are reported as well.
+ */
+void
+OS_CryptoPool_checkLeaks(void);
+
+/**
+ * @brief Get statistics of the pool
+ *
+ * @param stats (required) buffer for statistics
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if operation succeeded
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid
+ * @retval OS_ERROR_INVALID_STATE if the pool is not set up
+ */
+OS_Error_t
+OS_CryptoPool_getStats(
+    OS_CryptoPool_Stats_t* stats);
+
+/** @} */
@@ -24,6 +24,7 @@
 #include "OS_Error.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
 /**
  * Special flags to use when generating random numbers.
@@ -31,8 +32,73 @@
 typedef enum
 {
     OS_CryptoRng_FLAG_NONE = 0,
+
+    /**
+     * Bypass the buffered pool (if configured) and take the bytes directly
+     * from the RNG, e.g. when the caller derives long-term secrets from them.
+     */
+    OS_CryptoRng_FLAG_UNBUFFERED = (1u << 0),
 } OS_CryptoRng_Flag_t;
 
+/**
+ * Configuration of the buffered front end of the RNG. If set up, small
+ * requests (e.g., nonces, IVs, blinding values) are served from pools of bytes
+ * that are pre-generated by the RNG in large chunks, so they do not have to go
+ * through the full call path (and an RPC in OS_Crypto_MODE_CLIENT) each.
+ *
+ * Each thread uses its own pool, so no locking is required; the pool of a
+ * thread is selected by the index returned from getThreadIdx().
+ *
+ * The Crypto API itself uses the pools as follows:
+ * - OS_CryptoKey_generate() always bypasses the pools, so key material is
+ *   always taken directly from the RNG;
+ * - ECDSA nonces bypass the pools as well, as they are as sensitive as the
+ *   private key;
+ * - other random values drawn internally (e.g., RSA blinding values and RSA-PSS
+ *   salts) are served from the pools.
+ */
+typedef struct
+{
+    /**
+     * Size of each pool in bytes, 0 disables the buffered front end
+     */
+    size_t poolSize;
+
+    /**
+     * Number of pools, i.e., the number of threads that use the Crypto API
+     */
+    size_t numPools;
+
+    /**
+     * Requests larger than this are always served by the RNG directly
+     */
+    size_t maxRequest;
+
+    /**
+     * Pools are discarded and the RNG is reseeded with fresh entropy once
+     * this many bytes have been served; 0 means no limit
+     */
+    uint64_t reseedBytes;
+
+    /**
+     * Pools are discarded and the RNG is reseeded with fresh entropy once
+     * this many milliseconds have passed since the last reseed; 0 means no
+     * limit, otherwise getTimeMs() must be set
+     */
+    uint64_t reseedMs;
+
+    /**
+     * Optional, returns the index of the calling thread's pool in the range
+     * of [0, numPools); can be NULL if numPools is 1
+     */
+    size_t (*getThreadIdx)(void);
+
+    /**
+     * Optional, returns a monotonic time in milliseconds
+     */
+    uint64_t (*getTimeMs)(void);
+} OS_CryptoRng_Pool_t;
+
 /**
  * @brief Extract random numbers from internal RNG.
  *
@@ -43,6 +109,10 @@ typedef enum
  * from the entropy source into the RNG state to enhance prediction resistance.
  * This behavior can be modified by passing respective \p flags.
  *
+ * If a buffered pool is configured (see OS_CryptoRng_Pool_t), requests up to
+ * its maxRequest are served from the calling thread's pool instead; entropy is
+ * then only added when the pool is refilled or a reseed budget is exhausted.
+ *
  * @param hCrypto (required) handle of OS Crypto API
  * @param flags (optional) flags for RNG operation
  * @param buf (required) buffer for random bytes
@@ -67,7 +137,7 @@ OS_CryptoRng_getBytes(
  *
  * Feed an arbitrary string of bytes into the DRBG's internal state at any time
  * via this function. This can be used, for instance, to add a device-specific
- * seed to the RNG's state.
+ * seed to the RNG's state. Any bytes buffered in pools are discarded.
  *
  * @param hCrypto (required) handle of OS Crypto API
  * @param seed (required) additional seed to feed into RNG state
@@ -23,6 +23,18 @@
 #include "OS_Error.h"
 
 #include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Size of an Ed25519 signature in bytes.
+ */
+#define OS_CryptoSignature_SIZE_ED25519    64
+
+/**
+ * Maximum size of an ECDSA signature in bytes (DER encoded r and s for 256 bit
+ * curves).
+ */
+#define OS_CryptoSignature_SIZE_ECDSA_MAX  72
 
 /**
  * Type of SIGNATURE algorithm to use.
@@ -40,7 +52,33 @@ typedef enum
      * Use RSA with PKCS#1 V2.1 padding; resulting signatures are probabilistic,
      * e.g. the value-to-be-signed includes some randomness.
      */
-    OS_CryptoSignature_ALG_RSA_PKCS1_V21
+    OS_CryptoSignature_ALG_RSA_PKCS1_V21,
+
+    /**
+     * Use Ed25519 (PureEdDSA, RFC 8032); the value passed as hash is the
+     * message itself and is signed as-is, so the digest algorithm must be
+     * OS_CryptoDigest_ALG_NONE. Verification uses the cofactored equation of
+     * RFC 8032, section 5.1.7. For remote SIGNATURE objects the message must
+     * fit into the dataport; use OS_CryptoSignature_ALG_ED25519PH for larger
+     * messages (e.g., firmware images). Note that signing a digest of the
+     * message with this algorithm does not produce an Ed25519ph signature.
+     */
+    OS_CryptoSignature_ALG_ED25519,
+
+    /**
+     * Use ECDSA with keys on the SECP192r1, SECP224r1 or SECP256r1 curve;
+     * signatures are DER encoded. The tables for signing are computed once per
+     * Crypto API instance and curve.
+     */
+    OS_CryptoSignature_ALG_ECDSA,
+
+    /**
+     * Use Ed25519ph (HashEdDSA, RFC 8032) with Ed25519 keys; the value passed
+     * as hash is the SHA-512 prehash of the message, so the digest algorithm
+     * must be OS_CryptoDigest_ALG_SHA512. The signatures are not compatible
+     * with those of OS_CryptoSignature_ALG_ED25519.
+     */
+    OS_CryptoSignature_ALG_ED25519PH
 } OS_CryptoSignature_Alg_t;
 
 /// @cond INTERNAL
@@ -49,6 +87,29 @@ typedef OS_Crypto_Object_t* OS_CryptoSignature_Handle_t;
 //------------------------------------------------------------------------------
 /// @endcond
 
+/**
+ * A single signature to be checked with OS_CryptoSignature_verifyBatch().
+ */
+typedef struct
+{
+    /**
+     * Handle of OS Crypto Key object to use as public key
+     */
+    OS_CryptoKey_Handle_t hPubKey;
+
+    /**
+     * Hash value the signature was computed over and its size
+     */
+    const void* hash;
+    size_t hashSize;
+
+    /**
+     * Signature to verify and its size
+     */
+    const void* signature;
+    size_t signatureSize;
+} OS_CryptoSignature_BatchItem_t;
+
 /**
  * @brief Initialize a SIGNATURE object
  *
@@ -102,6 +163,9 @@ OS_CryptoSignature_free(
  * SIGNATURE object; for this the \p hPrvKey param must be set during SIGNATURE
  * initialization.
  *
+ * RSA signatures are computed with the CRT values and Montgomery contexts
+ * cached in the KEY object, see OS_CryptoKey_RsaRrv_t.
+ *
  * @param hSig (required) handle of OS Crypto SIGNATURE object
  * @param hash (required) hash value to sign
  * @param hashSize (required) size of hash
@@ -153,4 +217,49 @@ OS_CryptoSignature_verify(
     const void*                 signature,
     const size_t                signatureSize);
 
+/**
+ * @brief Verify many signatures at once.
+ *
+ * Verifies all signatures given in \p items, which all have to use the same
+ * algorithms. Depending on the algorithm, this is considerably faster than
+ * verifying each signature on its own:
+ * - Ed25519 signatures are checked together with a single combined
+ *   multi-scalar multiplication, only if that fails the signatures are checked
+ *   individually to find the invalid ones;
+ * - ECDSA signatures are verified one by one (as r only carries the
+ *   x-coordinate of R, they cannot be combined), but share the precomputation
+ *   for their curve and for items using the same public key;
+ * - RSA signatures of items sharing the same public key share its setup.
+ * In any case, the bit of an item in \p results is exactly what
+ * OS_CryptoSignature_verify() would return for that item; for Ed25519 this
+ * holds because both use the cofactored verification equation.
+ * In OS_Crypto_MODE_CLIENT (and for remote keys in OS_Crypto_MODE_KEY_SWITCH)
+ * as many items as fit into the dataport are verified with a single RPC.
+ *
+ * @param hCrypto (required) handle of OS Crypto API
+ * @param sigAlgorithm (required) signature algorithm to use
+ * @param digAlgorithm (required) digest algorithm used for the hashes
+ * @param items (required) signatures to verify
+ * @param numItems (required) number of entries in \p items
+ * @param results (required) bitmap of (numItems + 7) / 8 bytes; bit (i % 8) of
+ *  byte (i / 8) is set if the signature of item i is valid and cleared otherwise
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if all signatures are valid
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid,
+ *  this includes passing the wrong type of key or an item that does not fit
+ *  into the dataport
+ * @retval OS_ERROR_NOT_SUPPORTED if \p sigAlgorithm is not supported
+ * @retval OS_ERROR_ABORTED if at least one signature is invalid, see
+ *  \p results for which
+ */
+OS_Error_t
+OS_CryptoSignature_verifyBatch(
+    const OS_Crypto_Handle_t              hCrypto,
+    const OS_CryptoSignature_Alg_t        sigAlgorithm,
+    const OS_CryptoDigest_Alg_t           digAlgorithm,
+    const OS_CryptoSignature_BatchItem_t* items,
+    const size_t                          numItems,
+    uint8_t*                              results);
+
 /** @} */
\ No newline at end of file
@@ -12,6 +12,36 @@
 
 #include <stdint.h>
 
+/**
+ * Entry of a batch as it is placed in the dataport for Crypto_batch(); the
+ * entries are followed by the input data, the output of each operation is
+ * written back into the dataport at the given output offset.
+ */
+typedef struct
+{
+    OS_Crypto_Object_t* obj;    ///< remote DIGEST, MAC or CIPHER object
+    uint32_t op;                ///< operation, see OS_Crypto_BatchOp_t
+    int32_t  result;            ///< set by the server to the OS_Error_t result
+    size_t   inOffset;          ///< offset of the input in the dataport
+    size_t   inLen;             ///< length of the input
+    size_t   outOffset;         ///< offset of the output in the dataport
+    size_t   outLen;            ///< output buffer size, set to bytes written
+} if_OS_Crypto_BatchEntry_t;
+
+/**
+ * Entry of a batch as it is placed in the dataport for
+ * Signature_verifyBatch(); the entries are followed by the hashes and
+ * signatures. The server writes the result bitmap to the start of the dataport.
+ */
+typedef struct
+{
+    OS_Crypto_Object_t* pubKey; ///< remote KEY object
+    size_t   hashOffset;        ///< offset of the hash in the dataport
+    size_t   hashLen;           ///< length of the hash
+    size_t   sigOffset;         ///< offset of the signature in the dataport
+    size_t   sigLen;            ///< length of the signature
+} if_OS_Crypto_SigBatchEntry_t;
+
 typedef struct
 {
     OS_Error_t (*Rng_getBytes)(unsigned int flags, size_t bufSize);
@@ -21,6 +51,8 @@ typedef struct
     OS_Error_t (*Mac_free)(OS_CryptoMac_Handle_t macObj);
     OS_Error_t (*Mac_process)(OS_CryptoMac_Handle_t macObj, size_t dataSize);
     OS_Error_t (*Mac_finalize)(OS_CryptoMac_Handle_t macObj, size_t* macSize);
+    OS_Error_t (*Mac_oneShot)(OS_CryptoKey_Handle_t keyObj, unsigned int algorithm,
+                              size_t dataSize, size_t* macSize);
     OS_Error_t (*Digest_init)(OS_CryptoDigest_Handle_t* pDigestObj,
                               unsigned int algorithm);
     OS_Error_t (*Digest_clone)(OS_CryptoDigest_Handle_t* pDigestObj,
@@ -29,11 +61,15 @@ typedef struct
     OS_Error_t (*Digest_process)(OS_CryptoDigest_Handle_t digestObj, size_t inLen);
     OS_Error_t (*Digest_finalize)(OS_CryptoDigest_Handle_t digestObj,
                                   size_t* digestSize);
+    OS_Error_t (*Digest_oneShot)(unsigned int algorithm, size_t inLen,
+                                 size_t* digestSize);
     OS_Error_t (*Key_generate)(OS_CryptoKey_Handle_t* pKeyObj);
     OS_Error_t (*Key_makePublic)(OS_CryptoKey_Handle_t* pPubKeyObj,
                                  OS_CryptoKey_Handle_t prvKeyObj);
     OS_Error_t (*Key_import)(OS_CryptoKey_Handle_t* pKeyObj);
     OS_Error_t (*Key_export)(OS_CryptoKey_Handle_t keyObj);
+    OS_Error_t (*Key_importCompact)(OS_CryptoKey_Handle_t* pKeyObj, size_t len);
+    OS_Error_t (*Key_exportCompact)(OS_CryptoKey_Handle_t keyObj, size_t* len);
     OS_Error_t (*Key_getParams)(OS_CryptoKey_Handle_t keyObj, size_t* paramSize);
     OS_Error_t (*Key_getAttribs)(OS_CryptoKey_Handle_t keyObj);
     OS_Error_t (*Key_loadParams)(unsigned int param, size_t* paramSize);
@@ -46,6 +82,8 @@ typedef struct
     OS_Error_t (*Signature_sign)(OS_CryptoSignature_Handle_t sigObj,
                                  size_t hashSize, size_t* signatureSize);
     OS_Error_t (*Signature_free)(OS_CryptoSignature_Handle_t sigObj);
+    OS_Error_t (*Signature_verifyBatch)(unsigned int algorithm, unsigned int digest,
+                                        size_t numItems);
     OS_Error_t (*Agreement_init)(OS_CryptoAgreement_Handle_t* pAgrObj,
                                  OS_CryptoKey_Handle_t prvObj, unsigned int algorithm);
     OS_Error_t (*Agreement_agree)(OS_CryptoAgreement_Handle_t agrObj,
@@ -53,11 +91,16 @@ typedef struct
     OS_Error_t (*Agreement_free)(OS_CryptoAgreement_Handle_t agrObj);
     OS_Error_t (*Cipher_init)(OS_CryptoCipher_Handle_t* pCipherObj,
                               OS_CryptoKey_Handle_t keyObj, unsigned int algorithm, size_t ivLen);
+    OS_Error_t (*Cipher_reinit)(OS_CryptoCipher_Handle_t cipherObj, size_t ivLen);
     OS_Error_t (*Cipher_free)(OS_CryptoCipher_Handle_t cipherObj);
     OS_Error_t (*Cipher_process)(OS_CryptoCipher_Handle_t cipherObj, size_t inLen,
                                  size_t* outSize);
     OS_Error_t (*Cipher_start)(OS_CryptoCipher_Handle_t cipherObj, size_t len);
     OS_Error_t (*Cipher_finalize)(OS_CryptoCipher_Handle_t cipherObj, size_t* len);
+    OS_Error_t (*Crypto_batch)(size_t numOps);
+    OS_Error_t (*Crypto_getCapabilities)(uint32_t* caps);
+    // Writes the calling client's OS_Crypto_KeyCacheCounters_t to the dataport
+    OS_Error_t (*Crypto_getKeyCacheStats)(void);
     OS_Dataport_t dataport;
 } if_OS_Crypto_t;
 
@@ -69,15 +112,19 @@ typedef struct
     .Mac_free           = _rpc_ ## _Mac_free,           \
     .Mac_process        = _rpc_ ## _Mac_process,        \
     .Mac_finalize       = _rpc_ ## _Mac_finalize,       \
+    .Mac_oneShot        = _rpc_ ## _Mac_oneShot,        \
     .Digest_init        = _rpc_ ## _Digest_init,        \
     .Digest_clone       = _rpc_ ## _Digest_clone,       \
     .Digest_free        = _rpc_ ## _Digest_free,        \
     .Digest_process     = _rpc_ ## _Digest_process,     \
     .Digest_finalize    = _rpc_ ## _Digest_finalize,    \
+    .Digest_oneShot     = _rpc_ ## _Digest_oneShot,     \
     .Key_generate       = _rpc_ ## _Key_generate,       \
     .Key_makePublic     = _rpc_ ## _Key_makePublic,     \
     .Key_import         = _rpc_ ## _Key_import,         \
     .Key_export         = _rpc_ ## _Key_export,         \
+    .Key_importCompact  = _rpc_ ## _Key_importCompact,  \
+    .Key_exportCompact  = _rpc_ ## _Key_exportCompact,  \
     .Key_getParams      = _rpc_ ## _Key_getParams,      \
     .Key_getAttribs     = _rpc_ ## _Key_getAttribs,     \
     .Key_loadParams     = _rpc_ ## _Key_loadParams,     \
@@ -86,14 +133,19 @@ typedef struct
     .Signature_verify   = _rpc_ ## _Signature_verify,   \
     .Signature_sign     = _rpc_ ## _Signature_sign,     \
     .Signature_free     = _rpc_ ## _Signature_free,     \
+    .Signature_verifyBatch = _rpc_ ## _Signature_verifyBatch, \
     .Agreement_init     = _rpc_ ## _Agreement_init,     \
     .Agreement_agree    = _rpc_ ## _Agreement_agree,    \
     .Agreement_free     = _rpc_ ## _Agreement_free,     \
     .Cipher_init        = _rpc_ ## _Cipher_init,        \
+    .Cipher_reinit      = _rpc_ ## _Cipher_reinit,      \
     .Cipher_free        = _rpc_ ## _Cipher_free,        \
     .Cipher_process     = _rpc_ ## _Cipher_process,     \
     .Cipher_start       = _rpc_ ## _Cipher_start,       \
     .Cipher_finalize    = _rpc_ ## _Cipher_finalize,    \
+    .Crypto_batch       = _rpc_ ## _Crypto_batch,       \
+    .Crypto_getCapabilities = _rpc_ ## _Crypto_getCapabilities, \
+    .Crypto_getKeyCacheStats = _rpc_ ## _Crypto_getKeyCacheStats, \
     .dataport           = OS_DATAPORT_ASSIGN(_port_)    \
 }
 
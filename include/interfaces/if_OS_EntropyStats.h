@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+#pragma once
+
+#include "OS_Dataport.h"
+#include "OS_Error.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Number of buckets of the latency histogram. The buckets are disjoint: bucket
+ * 0 counts requests which took [0, 1) microseconds, bucket i counts requests
+ * which took [2^(i-1), 2^i) microseconds and the last bucket counts all
+ * requests which took 2^(OS_Entropy_LATENCY_BUCKETS - 2) microseconds or more.
+ */
+#define OS_Entropy_LATENCY_BUCKETS  16
+
+/**
+ * State of one of the continuous health tests of NIST SP 800-90B, section 4.4.
+ */
+typedef struct
+{
+    uint32_t cutoff;        ///< cutoff value C of the test
+    uint32_t maxObserved;   ///< highest count seen so far
+    uint64_t failures;      ///< number of times the cutoff was reached
+} OS_Entropy_HealthTest_t;
+
+/**
+ * Statistics of an entropy source, written to the dataport by getStats().
+ */
+typedef struct
+{
+    uint64_t bytesDelivered;    ///< bytes handed out since the server started
+    uint64_t requests;          ///< requests served (reads and ring refills)
+    uint64_t latencyHist[OS_Entropy_LATENCY_BUCKETS];  ///< requests per bucket
+    OS_Entropy_HealthTest_t repetitionCount;
+    OS_Entropy_HealthTest_t adaptiveProportion;
+    uint32_t windowSize;        ///< window of the adaptive proportion test
+    bool     healthy;           ///< false if the source is currently blocked
+} OS_Entropy_Stats_t;
+
+typedef struct
+{
+    OS_Error_t (*getStats)(void);
+    OS_Dataport_t dataport;
+} if_OS_EntropyStats_t;
+
+#define IF_OS_ENTROPY_STATS_ASSIGN(_rpc_, _port_)   \
+{                                                   \
+    .getStats = _rpc_ ## _getStats,                 \
+    .dataport = OS_DATAPORT_ASSIGN(_port_)          \
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+#pragma once
+
+#include "OS_Dataport.h"
+#include "OS_Error.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef struct
+{
+    OS_Error_t (*start)(uint32_t slots);
+    OS_Error_t (*refill)(void);
+    void (*notify_wait)(void);
+    int (*notify_poll)(void);
+
+    OS_DataportRing_t ring;
+} if_OS_EntropyStream_t;
+
+#define IF_OS_ENTROPY_STREAM_ASSIGN(_prefix_, _slots_)                         \
+{                                                                              \
+    .start          = _prefix_##_rpc_start,                                    \
+    .refill         = _prefix_##_rpc_refill,                                   \
+    .notify_wait    = _prefix_##_event_notify_wait,                            \
+    .notify_poll    = _prefix_##_event_notify_poll,                            \
+                                                                               \
+    .ring           = OS_DATAPORT_ASSIGN_RING(_prefix_##_ring_port, _slots_)   \
+}
+
+/**
+ * @brief Take entropy from the ring of a streaming entropy interface.
+ *
+ * Bytes are taken from the ring without an RPC; once the ring has been drained
+ * to half its slots, the server is asked to refill it. Slots are consumed from
+ * their end, so a request smaller than a slot leaves the rest of the slot for
+ * the next call. Slots claiming more bytes than fit into a slot are dropped.
+ *
+ * @param entropy (required) streaming entropy interface, started with start()
+ * @param buf (required) buffer for entropy
+ * @param len (required) number of bytes requested
+ * @param wait if set, block on the server's notification until \p len bytes
+ *  have been collected; otherwise return as soon as the ring is empty
+ *
+ * @return number of bytes written to \p buf
+ */
+static __attribute__((unused)) size_t
+OS_Entropy_readStream(
+    const if_OS_EntropyStream_t* entropy,
+    void*                        buf,
+    const size_t                 len,
+    const bool                   wait)
+{
+    OS_DataportRing_SlotHeader_t* slot;
+    uint8_t* dst = (uint8_t*) buf;
+    uint8_t* src;
+    size_t n, avail, done = 0;
+
+    if ((NULL == entropy) || (NULL == buf) || (NULL == entropy->refill)
+        || !OS_DataportRing_isValid(entropy->ring))
+    {
+        return 0;
+    }
+
+    while (done < len)
+    {
+        if ((slot = OS_DataportRing_peek(entropy->ring)) == NULL)
+        {
+            if (entropy->refill() != OS_SUCCESS || !wait
+                || (NULL == entropy->notify_wait))
+            {
+                break;
+            }
+            entropy->notify_wait();
+            continue;
+        }
+
+        // The length is written by the server, so read it only once and
+        // never use it beyond the payload of the slot
+        avail = __atomic_load_n(&slot->len, __ATOMIC_RELAXED);
+        if (avail > OS_DataportRing_getPayloadSize(entropy->ring))
+        {
+            avail = 0;
+        }
+
+        n = (len - done) < avail ? (len - done) : avail;
+        avail -= n;
+        src = (uint8_t*) OS_DataportRing_getPayload(slot) + avail;
+        memcpy(dst + done, src, n);
+        memset(src, 0, n);
+        slot->len = (uint32_t) avail;
+        done += n;
+
+        if (avail == 0)
+        {
+            OS_DataportRing_release(entropy->ring);
+            if (OS_DataportRing_getPending(entropy->ring) ==
+                (entropy->ring.slots / 2))
+            {
+                entropy->refill();
+            }
+        }
+    }
+
+    return done;
+}
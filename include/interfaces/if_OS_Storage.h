@@ -20,10 +20,24 @@ typedef enum
 }
 OS_Storage_StateFlag_e;
 
+/**
+ * Descriptor for a single chunk of a vectored read/write. An array of these is
+ * placed at the start of the dataport; the data of each chunk is located at
+ * \p dpOffset within the same dataport.
+ */
+typedef struct
+{
+    off_t  offset;      ///< offset on the storage in bytes
+    size_t size;        ///< number of bytes to transfer
+    size_t dpOffset;    ///< offset of the chunk's data within the dataport
+} OS_Storage_IoVec_t;
+
 typedef struct
 {
     OS_Error_t (*write)(off_t offset, size_t size, size_t* written);
     OS_Error_t (*read)(off_t offset, size_t size, size_t* read);
+    OS_Error_t (*writev)(size_t count, size_t* written);
+    OS_Error_t (*readv)(size_t count, size_t* read);
     OS_Error_t (*erase)(off_t offset, off_t size, off_t* erased);
     OS_Error_t (*getSize)(off_t* size);
     OS_Error_t (*getBlockSize)(size_t* blockSize);
@@ -36,6 +50,8 @@ typedef struct
 {                                                   \
     .write          = _rpc_ ## _write,              \
     .read           = _rpc_ ## _read,               \
+    .writev         = _rpc_ ## _writev,             \
+    .readv          = _rpc_ ## _readv,              \
     .erase          = _rpc_ ## _erase,              \
     .getSize        = _rpc_ ## _getSize,            \
     .getBlockSize   = _rpc_ ## _getBlockSize,       \
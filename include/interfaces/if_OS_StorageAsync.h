@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2024, HENSOLDT Cyber GmbH
+ * 
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * For commercial licensing, contact: info.cyber@hensoldt.net
+ */
+
+#pragma once
+
+#include "OS_Dataport.h"
+#include "OS_Error.h"
+
+#include <stdint.h>
+#include "stdio.h"
+
+/**
+ * Operations which can be submitted to the asynchronous storage interface.
+ */
+typedef enum
+{
+    OS_StorageAsync_OP_NONE = 0,
+    OS_StorageAsync_OP_READ,
+    OS_StorageAsync_OP_WRITE,
+    OS_StorageAsync_OP_ERASE,
+} OS_StorageAsync_Op_t;
+
+/**
+ * Entry of the submission ring; the data of READ and WRITE requests is located
+ * at \p dpOffset within the data dataport.
+ */
+typedef struct
+{
+    uint32_t id;        ///< chosen by the client, returned with the completion
+    uint32_t op;        ///< operation, see OS_StorageAsync_Op_t
+    off_t    offset;    ///< offset on the storage in bytes
+    size_t   size;      ///< number of bytes to read/write/erase
+    size_t   dpOffset;  ///< offset of the data within the data dataport
+} OS_StorageAsync_Request_t;
+
+/**
+ * Entry of the completion ring.
+ */
+typedef struct
+{
+    uint32_t   id;      ///< id of the request that completed
+    OS_Error_t status;  ///< result of the operation
+    size_t     size;    ///< number of bytes read/written/erased
+} OS_StorageAsync_Completion_t;
+
+typedef struct
+{
+    OS_Error_t (*init)(uint32_t depth);
+    OS_Error_t (*submit)(void);
+    void (*notify_wait)(void);
+    int (*notify_poll)(void);
+
+    OS_DataportRing_t sq;
+    OS_DataportRing_t cq;
+    OS_Dataport_t dataport;
+} if_OS_StorageAsync_t;
+
+#define IF_OS_STORAGE_ASYNC_ASSIGN(_prefix_, _depth_)                          \
+{                                                                              \
+    .init           = _prefix_##_rpc_init,                                     \
+    .submit         = _prefix_##_rpc_submit,                                   \
+    .notify_wait    = _prefix_##_event_notify_wait,                            \
+    .notify_poll    = _prefix_##_event_notify_poll,                            \
+                                                                               \
+    .sq             = OS_DATAPORT_ASSIGN_RING(_prefix_##_sq_port, _depth_),    \
+    .cq             = OS_DATAPORT_ASSIGN_RING(_prefix_##_cq_port, _depth_),    \
+    .dataport       = OS_DATAPORT_ASSIGN(_prefix_##_port)                      \
+}
+
+/**
+ * @brief Queue requests to the submission ring and notify the server.
+ *
+ * Requests are queued in the given order until the submission ring is full;
+ * the server is notified once for all queued requests.
+ *
+ * @param io (required) asynchronous storage interface
+ * @param reqs (required) requests to submit
+ * @param count (required) number of requests in \p reqs
+ * @param submitted (required) set to the number of requests queued
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if all requests were submitted
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid
+ * @retval OS_ERROR_NOT_INITIALIZED if the rings were not set up with init() or
+ *  their layout does not match \p io
+ * @retval OS_ERROR_BUFFER_FULL if only some (or no) requests could be queued,
+ *  as the submission ring is full
+ */
+static __attribute__((unused)) OS_Error_t
+OS_Storage_submit(
+    const if_OS_StorageAsync_t*      io,
+    const OS_StorageAsync_Request_t* reqs,
+    const size_t                     count,
+    size_t*                          submitted)
+{
+    OS_DataportRing_SlotHeader_t* slot;
+    OS_Error_t err;
+    size_t n;
+
+    if ((NULL == io) || (NULL == reqs) || (NULL == submitted)
+        || (NULL == io->submit)
+        || (OS_DataportRing_getPayloadSize(io->sq) <
+            sizeof(OS_StorageAsync_Request_t)))
+    {
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    *submitted = 0;
+
+    if (!OS_DataportRing_isValid(io->sq) || !OS_DataportRing_isValid(io->cq))
+    {
+        return OS_ERROR_NOT_INITIALIZED;
+    }
+
+    for (n = 0; n < count; n++)
+    {
+        if ((slot = OS_DataportRing_reserve(io->sq)) == NULL)
+        {
+            break;
+        }
+        slot->id     = reqs[n].id;
+        slot->len    = sizeof(OS_StorageAsync_Request_t);
+        slot->status = 0;
+        slot->flags  = 0;
+        *(OS_StorageAsync_Request_t*)OS_DataportRing_getPayload(slot) = reqs[n];
+        OS_DataportRing_commit(io->sq);
+    }
+
+    *submitted = n;
+
+    if ((n > 0) && ((err = io->submit()) != OS_SUCCESS))
+    {
+        return err;
+    }
+
+    return (n < count) ? OS_ERROR_BUFFER_FULL : OS_SUCCESS;
+}
+
+/**
+ * @brief Collect completions from the completion ring.
+ *
+ * This function does not block; use notify_wait() of the interface to wait
+ * for the server to signal new completions.
+ *
+ * @param io (required) asynchronous storage interface
+ * @param cqes (required) buffer for completions
+ * @param count (required) number of entries \p cqes can hold
+ * @param reaped (required) set to the number of completions written to \p cqes
+ *
+ * @return an error code
+ * @retval OS_SUCCESS if at least one completion was collected
+ * @retval OS_ERROR_INVALID_PARAMETER if a parameter was missing or invalid
+ * @retval OS_ERROR_NOT_INITIALIZED if the rings were not set up with init() or
+ *  their layout does not match \p io
+ * @retval OS_ERROR_NO_DATA if no completion was pending
+ */
+static __attribute__((unused)) OS_Error_t
+OS_Storage_reap(
+    const if_OS_StorageAsync_t*   io,
+    OS_StorageAsync_Completion_t* cqes,
+    const size_t                  count,
+    size_t*                       reaped)
+{
+    OS_DataportRing_SlotHeader_t* slot;
+    size_t n;
+
+    if ((NULL == io) || (NULL == cqes) || (NULL == reaped)
+        || (OS_DataportRing_getPayloadSize(io->cq) <
+            sizeof(OS_StorageAsync_Completion_t)))
+    {
+        return OS_ERROR_INVALID_PARAMETER;
+    }
+
+    *reaped = 0;
+
+    if (!OS_DataportRing_isValid(io->sq) || !OS_DataportRing_isValid(io->cq))
+    {
+        return OS_ERROR_NOT_INITIALIZED;
+    }
+
+    for (n = 0; n < count; n++)
+    {
+        if ((slot = OS_DataportRing_peek(io->cq)) == NULL)
+        {
+            break;
+        }
+        cqes[n] = *(OS_StorageAsync_Completion_t*)OS_DataportRing_getPayload(slot);
+        OS_DataportRing_release(io->cq);
+    }
+
+    *reaped = n;
+
+    return (n > 0) ? OS_SUCCESS : OS_ERROR_NO_DATA;
+}